@@ -17,6 +17,25 @@
  */
 PetscErrorCode DMPlexReconstructGradients_Internal(DM dm, PetscFV fvm, PetscInt fStart, PetscInt fEnd, Vec faceGeometry, Vec cellGeometry, Vec locX, Vec grad);
 
+PetscLogEvent ABLATE_FVSupport_GradientReconstruction = -1;
+PetscLogEvent ABLATE_FVSupport_FluxResidual = -1;
+PetscLogEvent ABLATE_FVSupport_PointResidual = -1;
+PetscLogEvent ABLATE_FVSupport_AuxUpdate = -1;
+
+PetscErrorCode ABLATE_FVSupportRegisterLogEvents(void) {
+    PetscErrorCode ierr;
+    static PetscBool registered = PETSC_FALSE;
+
+    PetscFunctionBeginUser;
+    if (registered) PetscFunctionReturn(0);
+    ierr = PetscLogEventRegister("FVGradRecon", DM_CLASSID, &ABLATE_FVSupport_GradientReconstruction);CHKERRQ(ierr);
+    ierr = PetscLogEventRegister("FVFluxResidual", DM_CLASSID, &ABLATE_FVSupport_FluxResidual);CHKERRQ(ierr);
+    ierr = PetscLogEventRegister("FVPointResidual", DM_CLASSID, &ABLATE_FVSupport_PointResidual);CHKERRQ(ierr);
+    ierr = PetscLogEventRegister("FVAuxUpdate", DM_CLASSID, &ABLATE_FVSupport_AuxUpdate);CHKERRQ(ierr);
+    registered = PETSC_TRUE;
+    PetscFunctionReturn(0);
+}
+
 /*@
   DMPlexReconstructGradientsFVM - reconstruct the gradient of a vector using a finite volume method for a specific field
 
@@ -645,6 +664,8 @@ PetscErrorCode ABLATE_DMPlexComputeFluxResidual_Internal(FVMRHSFluxFunctionDescr
     PetscErrorCode   ierr;
 
     PetscFunctionBeginUser;
+    ierr = ABLATE_FVSupportRegisterLogEvents();CHKERRQ(ierr);
+    ierr = PetscLogEventBegin(ABLATE_FVSupport_FluxResidual, dm, 0, 0, 0);CHKERRQ(ierr);
     /* FEM+FVM */
     ierr = ISGetPointRange(cellIS, &cStart, &cEnd, &cells);CHKERRQ(ierr);
     ierr = DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd);CHKERRQ(ierr);
@@ -677,6 +698,7 @@ PetscErrorCode ABLATE_DMPlexComputeFluxResidual_Internal(FVMRHSFluxFunctionDescr
     ierr = PetscCalloc1(nf, &locGrads);CHKERRQ(ierr);
 
     /* Reconstruct and limit cell gradients */
+    ierr = PetscLogEventBegin(ABLATE_FVSupport_GradientReconstruction, dm, 0, 0, 0);CHKERRQ(ierr);
     // for each field compute the gradient in the localGrads vector
     for (PetscInt f = 0; f < nf; f++){
         PetscFV fvm;
@@ -735,6 +757,7 @@ PetscErrorCode ABLATE_DMPlexComputeFluxResidual_Internal(FVMRHSFluxFunctionDescr
             ierr = DMRestoreGlobalVector(dmAuxGrads[f], &grad);CHKERRQ(ierr);
         }
     }
+    ierr = PetscLogEventEnd(ABLATE_FVSupport_GradientReconstruction, dm, 0, 0, 0);CHKERRQ(ierr);
 
 
     /* Loop over chunks */
@@ -889,6 +912,7 @@ PetscErrorCode ABLATE_DMPlexComputeFluxResidual_Internal(FVMRHSFluxFunctionDescr
 
     PetscFree(dmGrads);
     PetscFree(locGrads);
+    ierr = PetscLogEventEnd(ABLATE_FVSupport_FluxResidual, dm, 0, 0, 0);CHKERRQ(ierr);
     PetscFunctionReturn(0);
 }
 
@@ -904,6 +928,8 @@ PetscErrorCode ABLATE_DMPlexComputeFluxResidual_Internal(FVMRHSFluxFunctionDescr
 PetscErrorCode FVFlowUpdateAuxFieldsFV(PetscInt numberUpdateFunctions, FVAuxFieldUpdateFunctionDescription* functionDescriptions, DM dm, DM auxDM, PetscReal time, Vec locXVec, Vec locAuxField) {
     PetscFunctionBeginUser;
     PetscErrorCode ierr;
+    ierr = ABLATE_FVSupportRegisterLogEvents();CHKERRQ(ierr);
+    ierr = PetscLogEventBegin(ABLATE_FVSupport_AuxUpdate, dm, 0, 0, 0);CHKERRQ(ierr);
 
     // Extract the cell geometry, and the dm that holds the information
     Vec cellGeomVec;
@@ -972,12 +998,15 @@ PetscErrorCode FVFlowUpdateAuxFieldsFV(PetscInt numberUpdateFunctions, FVAuxFiel
     ierr = VecRestoreArray(locAuxField, &localAuxFlowFieldArray);CHKERRQ(ierr);
     PetscFree(uOff);
 
+    ierr = PetscLogEventEnd(ABLATE_FVSupport_AuxUpdate, dm, 0, 0, 0);CHKERRQ(ierr);
     PetscFunctionReturn(0);
 }
 
 PetscErrorCode ABLATE_DMPlexComputePointResidual_Internal(FVMRHSPointFunctionDescription *functionDescriptions, PetscInt numberFunctionDescription, DM dm, IS cellIS, PetscReal time, Vec locX, Vec locX_t, PetscReal t, Vec locF) {
     PetscFunctionBeginUser;
     PetscErrorCode ierr;
+    ierr = ABLATE_FVSupportRegisterLogEvents();CHKERRQ(ierr);
+    ierr = PetscLogEventBegin(ABLATE_FVSupport_PointResidual, dm, 0, 0, 0);CHKERRQ(ierr);
 
     /* FEM+FVM */
     PetscInt         cStart, cEnd;
@@ -1119,5 +1148,6 @@ PetscErrorCode ABLATE_DMPlexComputePointResidual_Internal(FVMRHSPointFunctionDes
     ierr = VecRestoreArrayRead(cellGeometryVec, &cellGeometryArray);CHKERRQ(ierr);
     ierr = ISRestorePointRange(cellIS, &cStart, &cEnd, &cells);CHKERRQ(ierr);
 
+    ierr = PetscLogEventEnd(ABLATE_FVSupport_PointResidual, dm, 0, 0, 0);CHKERRQ(ierr);
     PetscFunctionReturn(0);
 }
\ No newline at end of file
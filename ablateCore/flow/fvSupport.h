@@ -65,6 +65,20 @@ struct _FVAuxFieldUpdateFunctionDescription {
 typedef struct _FVAuxFieldUpdateFunctionDescription FVAuxFieldUpdateFunctionDescription;
 
 
+/**
+ * Log events for the finite volume hot paths.  These are registered the first time any fvSupport function is called.
+ */
+PETSC_EXTERN PetscLogEvent ABLATE_FVSupport_GradientReconstruction;
+PETSC_EXTERN PetscLogEvent ABLATE_FVSupport_FluxResidual;
+PETSC_EXTERN PetscLogEvent ABLATE_FVSupport_PointResidual;
+PETSC_EXTERN PetscLogEvent ABLATE_FVSupport_AuxUpdate;
+
+/**
+ * Registers the fvSupport log events if they have not already been registered
+ * @return
+ */
+PETSC_EXTERN PetscErrorCode ABLATE_FVSupportRegisterLogEvents(void);
+
 /**
   DMPlexTSComputeRHSFunctionFVM - Form the local forcing F from the local input X using flux and pointfunctions specified by the user
 
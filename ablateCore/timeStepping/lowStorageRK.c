@@ -0,0 +1,205 @@
+#include "lowStorageRK.h"
+#include <petsc/private/tsimpl.h> /*I "petscts.h" I*/
+
+#define LSRK_MAX_STAGES 5
+
+/**
+ * The coefficients for a 2N low storage scheme
+ *   dU = A[i]*dU + dt*F(t + C[i]*dt, U)
+ *   U  = U + B[i]*dU
+ */
+typedef struct {
+    const char *name;
+    PetscInt    order;
+    PetscInt    numberStages;
+    PetscReal   A[LSRK_MAX_STAGES];
+    PetscReal   B[LSRK_MAX_STAGES];
+    PetscReal   C[LSRK_MAX_STAGES];
+} LSRKTableau;
+
+static const LSRKTableau lsrkTableaus[] = {
+    /* Williamson, Low-storage Runge-Kutta schemes, JCP 1980 */
+    {TSLSRK3, 3, 3, {0.0, -5.0 / 9.0, -153.0 / 128.0}, {1.0 / 3.0, 15.0 / 16.0, 8.0 / 15.0}, {0.0, 1.0 / 3.0, 3.0 / 4.0}},
+    /* Carpenter and Kennedy, Fourth-order 2N-storage Runge-Kutta schemes, NASA TM 109112, 1994 */
+    {TSLSRK4,
+     4,
+     5,
+     {0.0, -567301805773.0 / 1357537059087.0, -2404267990393.0 / 2016746695238.0, -3550918686646.0 / 2091501179385.0, -1275806237668.0 / 842570457699.0},
+     {1432997174477.0 / 9575080441755.0, 5161836677717.0 / 13612068292357.0, 1720146321549.0 / 2090206949498.0, 3134564353537.0 / 4481467310338.0, 2277821191437.0 / 14882151754819.0},
+     {0.0, 1432997174477.0 / 9575080441755.0, 2526269341429.0 / 6820363962896.0, 2006345519317.0 / 3224310063776.0, 2802321613138.0 / 2924317926251.0}}};
+
+typedef struct {
+    const LSRKTableau *tableau;
+    Vec                increment; /* the 2N stage increment register */
+    Vec                rhs;       /* holds the rhs evaluation for each stage */
+} TS_LSRK;
+
+static PetscErrorCode TSStep_LSRK(TS ts)
+{
+    TS_LSRK           *lsrk = (TS_LSRK *)ts->data;
+    const LSRKTableau *tab  = lsrk->tableau;
+    Vec                solution = ts->vec_sol;
+    const PetscReal    dt = ts->time_step;
+    PetscBool          stageok;
+    PetscErrorCode     ierr;
+
+    PetscFunctionBegin;
+    ierr = VecZeroEntries(lsrk->increment);CHKERRQ(ierr);
+    for (PetscInt s = 0; s < tab->numberStages; s++) {
+        const PetscReal stageTime = ts->ptime + tab->C[s] * dt;
+
+        ierr = TSPreStage(ts, stageTime);CHKERRQ(ierr);
+        ierr = TSComputeRHSFunction(ts, stageTime, solution, lsrk->rhs);CHKERRQ(ierr);
+        ierr = VecAXPBY(lsrk->increment, dt, tab->A[s], lsrk->rhs);CHKERRQ(ierr);
+        ierr = VecAXPY(solution, tab->B[s], lsrk->increment);CHKERRQ(ierr);
+        ierr = TSPostStage(ts, stageTime, s, &solution);CHKERRQ(ierr);
+
+        // the solution is updated in place so a rejected stage cannot be retried
+        ierr = TSAdaptCheckStage(ts->adapt, ts, stageTime, solution, &stageok);CHKERRQ(ierr);
+        if (!stageok) {
+            ts->reason = TS_DIVERGED_STEP_REJECTED;
+            PetscFunctionReturn(0);
+        }
+    }
+
+    ts->ptime += dt;
+    PetscFunctionReturn(0);
+}
+
+static PetscErrorCode TSReset_LSRK(TS ts)
+{
+    TS_LSRK       *lsrk = (TS_LSRK *)ts->data;
+    PetscErrorCode ierr;
+
+    PetscFunctionBegin;
+    ierr = VecDestroy(&lsrk->increment);CHKERRQ(ierr);
+    ierr = VecDestroy(&lsrk->rhs);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+}
+
+static PetscErrorCode TSDestroy_LSRK(TS ts)
+{
+    PetscErrorCode ierr;
+
+    PetscFunctionBegin;
+    ierr = TSReset_LSRK(ts);CHKERRQ(ierr);
+    ierr = PetscObjectComposeFunction((PetscObject)ts, "TSLSRKSetType_C", NULL);CHKERRQ(ierr);
+    ierr = PetscFree(ts->data);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+}
+
+static PetscErrorCode TSSetUp_LSRK(TS ts)
+{
+    TS_LSRK       *lsrk = (TS_LSRK *)ts->data;
+    PetscBool      isNone;
+    PetscErrorCode ierr;
+
+    PetscFunctionBegin;
+    ierr = TSCheckImplicitTerm(ts);CHKERRQ(ierr);
+    ierr = TSGetAdapt(ts, &ts->adapt);CHKERRQ(ierr);
+    ierr = TSAdaptCandidatesClear(ts->adapt);CHKERRQ(ierr);
+    ierr = PetscObjectTypeCompare((PetscObject)ts->adapt, TSADAPTNONE, &isNone);CHKERRQ(ierr);
+    if (!isNone) SETERRQ(PetscObjectComm((PetscObject)ts), PETSC_ERR_SUP, "The lsrk time stepper does not provide an error estimate and only supports -ts_adapt_type none");
+    ierr = VecDuplicate(ts->vec_sol, &lsrk->increment);CHKERRQ(ierr);
+    ierr = VecDuplicate(ts->vec_sol, &lsrk->rhs);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+}
+
+static PetscErrorCode TSLSRKSetType_LSRK(TS ts, const char *type)
+{
+    TS_LSRK *lsrk = (TS_LSRK *)ts->data;
+    PetscBool match;
+    PetscErrorCode ierr;
+
+    PetscFunctionBegin;
+    for (size_t t = 0; t < sizeof(lsrkTableaus) / sizeof(lsrkTableaus[0]); t++) {
+        ierr = PetscStrcmp(type, lsrkTableaus[t].name, &match);CHKERRQ(ierr);
+        if (match) {
+            lsrk->tableau = &lsrkTableaus[t];
+            PetscFunctionReturn(0);
+        }
+    }
+    SETERRQ1(PetscObjectComm((PetscObject)ts), PETSC_ERR_ARG_UNKNOWN_TYPE, "Unknown lsrk type %s", type);
+}
+
+static PetscErrorCode TSSetFromOptions_LSRK(PetscOptionItems *PetscOptionsObject, TS ts)
+{
+    TS_LSRK       *lsrk = (TS_LSRK *)ts->data;
+    const char    *names[sizeof(lsrkTableaus) / sizeof(lsrkTableaus[0])];
+    PetscInt       choice = 0;
+    PetscBool      flg;
+    PetscErrorCode ierr;
+
+    PetscFunctionBegin;
+    for (size_t t = 0; t < sizeof(lsrkTableaus) / sizeof(lsrkTableaus[0]); t++) {
+        names[t] = lsrkTableaus[t].name;
+        if (lsrk->tableau == &lsrkTableaus[t]) choice = (PetscInt)t;
+    }
+    ierr = PetscOptionsHead(PetscOptionsObject, "Low storage RK ODE solver options");CHKERRQ(ierr);
+    ierr = PetscOptionsEList("-ts_lsrk_type", "Low storage RK scheme (order)", "TSLSRKSetType", names, (PetscInt)(sizeof(names) / sizeof(names[0])), names[choice], &choice, &flg);CHKERRQ(ierr);
+    if (flg) {
+        ierr = TSLSRKSetType(ts, names[choice]);CHKERRQ(ierr);
+    }
+    ierr = PetscOptionsTail();CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+}
+
+static PetscErrorCode TSView_LSRK(TS ts, PetscViewer viewer)
+{
+    TS_LSRK       *lsrk = (TS_LSRK *)ts->data;
+    PetscBool      iascii;
+    PetscErrorCode ierr;
+
+    PetscFunctionBegin;
+    ierr = PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERASCII, &iascii);CHKERRQ(ierr);
+    if (iascii) {
+        ierr = PetscViewerASCIIPrintf(viewer, "  Low storage RK type %s: order %D with %D stages\n", lsrk->tableau->name, lsrk->tableau->order, lsrk->tableau->numberStages);CHKERRQ(ierr);
+    }
+    PetscFunctionReturn(0);
+}
+
+static PetscErrorCode TSCreate_LSRK(TS ts)
+{
+    TS_LSRK       *lsrk;
+    PetscErrorCode ierr;
+
+    PetscFunctionBegin;
+    ts->ops->reset          = TSReset_LSRK;
+    ts->ops->destroy        = TSDestroy_LSRK;
+    ts->ops->setup          = TSSetUp_LSRK;
+    ts->ops->step           = TSStep_LSRK;
+    ts->ops->setfromoptions = TSSetFromOptions_LSRK;
+    ts->ops->view           = TSView_LSRK;
+
+    ts->default_adapt_type = TSADAPTNONE;
+    ts->usessnes           = PETSC_FALSE;
+
+    ierr = PetscNewLog(ts, &lsrk);CHKERRQ(ierr);
+    lsrk->tableau = &lsrkTableaus[1];
+    ts->data      = (void *)lsrk;
+
+    ierr = PetscObjectComposeFunction((PetscObject)ts, "TSLSRKSetType_C", TSLSRKSetType_LSRK);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode TSLSRKSetType(TS ts, const char *type)
+{
+    PetscErrorCode ierr;
+
+    PetscFunctionBegin;
+    PetscValidHeaderSpecific(ts, TS_CLASSID, 1);
+    ierr = PetscTryMethod(ts, "TSLSRKSetType_C", (TS, const char *), (ts, type));CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode TSRegisterLowStorageRK(void)
+{
+    static PetscBool registered = PETSC_FALSE;
+    PetscErrorCode   ierr;
+
+    PetscFunctionBegin;
+    if (registered) PetscFunctionReturn(0);
+    ierr = TSRegister(TSLSRK, TSCreate_LSRK);CHKERRQ(ierr);
+    registered = PETSC_TRUE;
+    PetscFunctionReturn(0);
+}
@@ -0,0 +1,32 @@
+#if !defined(lowStorageRK_h)
+#define lowStorageRK_h
+
+#include <petscts.h>
+
+/**
+ * Low storage (2N, Williamson form) explicit Runge-Kutta time stepper.  Only the solution, a single stage increment, and the rhs are stored
+ * regardless of the number of stages.  The ts pre-stage and post-stage functions are called for every stage.
+ */
+#define TSLSRK "lsrk"
+
+/**
+ * The available low storage schemes, selected with -ts_lsrk_type
+ */
+#define TSLSRK3 "3"
+#define TSLSRK4 "4"
+
+/**
+ * Registers the lsrk TS type with PETSc.  This can be called more than once.
+ * @return
+ */
+PETSC_EXTERN PetscErrorCode TSRegisterLowStorageRK(void);
+
+/**
+ * Set the low storage scheme used by the lsrk TS
+ * @param ts
+ * @param type
+ * @return
+ */
+PETSC_EXTERN PetscErrorCode TSLSRKSetType(TS ts, const char* type);
+
+#endif
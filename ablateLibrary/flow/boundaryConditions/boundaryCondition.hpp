@@ -20,6 +20,12 @@ class BoundaryCondition {
 
     virtual ~BoundaryCondition() = default;
     virtual void SetupBoundary(PetscDS problem, PetscInt fieldId) = 0;
+
+    /**
+     * Called with the flow dm once the problem is set up and again whenever the flow dm changes (i.e. after repartitioning)
+     * @param dm
+     */
+    virtual void UpdateDomain(DM dm) {}
 };
 }  // namespace ablate::flow::boundaryConditions
 #endif  // ABLATELIBRARY_BOUNDARYCONDITION_HPP
@@ -0,0 +1,155 @@
+#include "characteristicGhost.hpp"
+#include <flow/processes/eulerAdvection.hpp>
+#include "utilities/petscError.hpp"
+
+using Components = ablate::flow::processes::EulerAdvection::Components;
+
+ablate::flow::boundaryConditions::CharacteristicGhost::CharacteristicGhost(std::string boundaryName, std::vector<int> labelIds, std::shared_ptr<eos::EOS> eos, double referencePressure,
+                                                                           std::vector<double> referenceVelocity, double referenceDensity, double sigma, std::string labelName)
+    : Ghost("euler", boundaryName, labelIds, CharacteristicGhostUpdate, this, labelName),
+      referencePressure(referencePressure),
+      referenceVelocity(referenceVelocity.begin(), referenceVelocity.end()),
+      referenceDensity(referenceDensity),
+      sigma(sigma),
+      decodeStateFunction(eos->GetDecodeStateFunction()),
+      decodeStateContext(eos->GetDecodeStateContext()),
+      numberSpecies((PetscInt)eos->GetSpecies().size()) {
+    if (sigma < 0.0 || sigma > 1.0) {
+        throw std::invalid_argument("The CharacteristicGhost sigma must be between 0 and 1 for boundary " + boundaryName);
+    }
+}
+
+void ablate::flow::boundaryConditions::CharacteristicGhost::SetupBoundary(PetscDS problem, PetscInt fieldId) {
+    Ghost::SetupBoundary(problem, fieldId);
+
+    if (numberSpecies > 0) {
+        // the update function is only passed the euler field, so find where the densityYi field is stored in the same cell
+        PetscInt numberFields;
+        PetscDSGetNumFields(problem, &numberFields) >> checkError;
+        PetscInt densityYiField = -1;
+        for (PetscInt f = 0; f < numberFields; f++) {
+            PetscObject discretization;
+            PetscDSGetDiscretization(problem, f, &discretization) >> checkError;
+            const char* fieldName;
+            PetscObjectGetName(discretization, &fieldName) >> checkError;
+            if (std::string(fieldName) == "densityYi") {
+                densityYiField = f;
+            }
+        }
+        if (densityYiField < 0) {
+            throw std::invalid_argument("The CharacteristicGhost boundary " + GetBoundaryName() + " requires a densityYi field when the eos has species");
+        }
+
+        PetscInt eulerFieldOffset, densityYiFieldOffset;
+        PetscDSGetFieldOffset(problem, fieldId, &eulerFieldOffset) >> checkError;
+        PetscDSGetFieldOffset(problem, densityYiField, &densityYiFieldOffset) >> checkError;
+        densityYiOffset = densityYiFieldOffset - eulerFieldOffset;
+    }
+}
+
+PetscErrorCode ablate::flow::boundaryConditions::CharacteristicGhost::CharacteristicGhostUpdate(PetscReal, const PetscReal*, const PetscReal* n, const PetscScalar* a_xI, PetscScalar* a_xG,
+                                                                                                 void* ctx) {
+    PetscFunctionBeginUser;
+    PetscErrorCode ierr;
+    auto boundary = (ablate::flow::boundaryConditions::CharacteristicGhost*)ctx;
+    const PetscInt dim = boundary->dim;
+
+    // the species are stored in the same cell as the euler field, so they can be used to decode the interior state
+    const PetscScalar* densityYi = boundary->numberSpecies > 0 ? a_xI + boundary->densityYiOffset : NULL;
+
+    // compute the outward unit normal
+    PetscReal area = 0.0;
+    for (PetscInt d = 0; d < dim; d++) {
+        area += n[d] * n[d];
+    }
+    area = PetscSqrtReal(area);
+    PetscReal normal[3];
+    for (PetscInt d = 0; d < dim; d++) {
+        normal[d] = n[d] / area;
+    }
+
+    // decode the interior state
+    const PetscReal density = a_xI[Components::RHO];
+    PetscReal velocity[3];
+    PetscReal normalVelocity = 0.0;
+    PetscReal kineticEnergy = 0.0;
+    for (PetscInt d = 0; d < dim; d++) {
+        velocity[d] = a_xI[Components::RHOU + d] / density;
+        normalVelocity += velocity[d] * normal[d];
+        kineticEnergy += 0.5 * velocity[d] * velocity[d];
+    }
+    PetscReal internalEnergy, a, p;
+    ierr = boundary->decodeStateFunction(dim, density, a_xI[Components::RHOE] / density, velocity, densityYi, &internalEnergy, &a, &p, boundary->decodeStateContext);
+    CHKERRQ(ierr);
+
+    // the characteristic variables, linearized about the interior state.  The waves travel at (un - a), un, un, (un + a) in the outward normal direction
+    const PetscReal rhoA = density * a;
+    PetscReal w1 = p - rhoA * normalVelocity;
+    PetscReal w2 = density - p / (a * a);
+    PetscReal w4 = p + rhoA * normalVelocity;
+    PetscReal tangentialVelocity[3];
+    for (PetscInt d = 0; d < dim; d++) {
+        tangentialVelocity[d] = velocity[d] - normalVelocity * normal[d];
+    }
+
+    // the same waves for the reference state, any values that are not provided are taken from the interior
+    PetscReal referenceNormalVelocity = normalVelocity;
+    PetscReal referenceTangentialVelocity[3];
+    PetscArraycpy(referenceTangentialVelocity, tangentialVelocity, dim);
+    if ((PetscInt)boundary->referenceVelocity.size() >= dim) {
+        referenceNormalVelocity = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            referenceNormalVelocity += boundary->referenceVelocity[d] * normal[d];
+        }
+        for (PetscInt d = 0; d < dim; d++) {
+            referenceTangentialVelocity[d] = boundary->referenceVelocity[d] - referenceNormalVelocity * normal[d];
+        }
+    }
+    const PetscReal w1Reference = boundary->referencePressure - rhoA * referenceNormalVelocity;
+    const PetscReal w4Reference = boundary->referencePressure + rhoA * referenceNormalVelocity;
+    const PetscReal w2Reference = boundary->referenceDensity > 0.0 ? boundary->referenceDensity - boundary->referencePressure / (a * a) : w2;
+
+    // outgoing waves are extrapolated, incoming waves come from the reference state
+    if (normalVelocity - a < 0.0) {
+        w1 += (normalVelocity + a < 0.0 ? 1.0 : boundary->sigma) * (w1Reference - w1);
+    }
+    if (normalVelocity < 0.0) {
+        w2 = w2Reference;
+        PetscArraycpy(tangentialVelocity, referenceTangentialVelocity, dim);
+    }
+    if (normalVelocity + a < 0.0) {
+        w4 = w4Reference;
+    }
+
+    // convert back to the primitive ghost state
+    const PetscReal ghostPressure = 0.5 * (w1 + w4);
+    const PetscReal ghostNormalVelocity = 0.5 * (w4 - w1) / rhoA;
+    const PetscReal ghostDensity = w2 + ghostPressure / (a * a);
+    if (ghostPressure <= 0.0 || ghostDensity <= 0.0) {
+        PetscArraycpy(a_xG, a_xI, boundary->fieldSize);
+        PetscFunctionReturn(0);
+    }
+
+    // scale the internal energy with p/rho (exact for a calorically perfect gas), the remaining energy (i.e. formation) is held constant
+    const PetscReal ghostInternalEnergy = internalEnergy * (ghostPressure / ghostDensity) / (p / density);
+    const PetscReal remainingEnergy = a_xI[Components::RHOE] / density - internalEnergy - kineticEnergy;
+
+    PetscReal ghostKineticEnergy = 0.0;
+    for (PetscInt d = 0; d < dim; d++) {
+        const PetscReal ghostVelocity = tangentialVelocity[d] + ghostNormalVelocity * normal[d];
+        ghostKineticEnergy += 0.5 * ghostVelocity * ghostVelocity;
+        a_xG[Components::RHOU + d] = ghostDensity * ghostVelocity;
+    }
+    a_xG[Components::RHO] = ghostDensity;
+    a_xG[Components::RHOE] = ghostDensity * (ghostInternalEnergy + remainingEnergy + ghostKineticEnergy);
+    PetscFunctionReturn(0);
+}
+
+#include "parser/registrar.hpp"
+REGISTER(ablate::flow::boundaryConditions::BoundaryCondition, ablate::flow::boundaryConditions::CharacteristicGhost,
+         "non-reflecting characteristic inflow/outflow boundary for the euler field using ghost cells", ARG(std::string, "boundaryName", "the name for this boundary condition"),
+         ARG(std::vector<int>, "labelIds", "the ids on the mesh to apply the boundary condition"), ARG(ablate::eos::EOS, "eos", "the equation of state used to describe the flow"),
+         ARG(double, "pressure", "the far field reference pressure"), OPT(std::vector<double>, "velocity", "the far field reference velocity, required for inflow (default is the interior velocity)"),
+         OPT(double, "density", "the far field reference density used for inflow (default is the interior entropy)"),
+         OPT(double, "sigma", "relaxation of the incoming acoustic wave toward the reference pressure, 0 is perfectly non-reflecting and 1 fully imposes the pressure (default is 0)"),
+         OPT(std::string, "labelName", "the mesh label holding the boundary ids (default Face Sets)"));
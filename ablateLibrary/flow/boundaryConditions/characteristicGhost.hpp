@@ -0,0 +1,44 @@
+#ifndef ABLATELIBRARY_CHARACTERISTICGHOST_HPP
+#define ABLATELIBRARY_CHARACTERISTICGHOST_HPP
+
+#include <eos/eos.hpp>
+#include <memory>
+#include <vector>
+#include "ghost.hpp"
+
+namespace ablate::flow::boundaryConditions {
+
+/**
+ * Non-reflecting (characteristic) inflow/outflow ghost boundary for the compressible euler field.  The ghost state is built from the linearized
+ * characteristic waves normal to the boundary.  Outgoing waves are extrapolated from the interior while incoming waves are relaxed toward the reference
+ * state, so acoustic waves leave the domain without being reflected.  The densityYi field (if used) is only read to decode the interior state and still needs its own
+ * boundary condition.
+ */
+class CharacteristicGhost : public Ghost {
+   private:
+    static PetscErrorCode CharacteristicGhostUpdate(PetscReal time, const PetscReal* c, const PetscReal* n, const PetscScalar* a_xI, PetscScalar* a_xG, void* ctx);
+
+    // the far field reference state
+    const PetscReal referencePressure;
+    const std::vector<PetscReal> referenceVelocity;
+    const PetscReal referenceDensity;
+
+    // relaxation of the incoming acoustic wave toward the reference pressure.  0 is perfectly non-reflecting and 1 fully imposes the reference
+    const PetscReal sigma;
+
+    // eos functions used to decode the interior state
+    eos::DecodeStateFunction decodeStateFunction;
+    void* decodeStateContext;
+    const PetscInt numberSpecies;
+
+    // the location of the densityYi field relative to the euler field in each cell
+    PetscInt densityYiOffset = 0;
+
+   public:
+    CharacteristicGhost(std::string boundaryName, std::vector<int> labelIds, std::shared_ptr<eos::EOS> eos, double referencePressure, std::vector<double> referenceVelocity = {},
+                        double referenceDensity = {}, double sigma = {}, std::string labelName = {});
+
+    void SetupBoundary(PetscDS problem, PetscInt field) override;
+};
+}  // namespace ablate::flow::boundaryConditions
+#endif  // ABLATELIBRARY_CHARACTERISTICGHOST_HPP
@@ -1,19 +1,133 @@
 #include "essentialGhost.hpp"
 ablate::flow::boundaryConditions::EssentialGhost::EssentialGhost(std::string boundaryName, std::vector<int> labelIds, std::shared_ptr<ablate::mathFunctions::FieldFunction> boundaryFunction,
-                                                                 std::string labelName)
-    : Ghost(boundaryFunction->GetName(), boundaryName, labelIds, EssentialGhostUpdate, this, labelName), boundaryFunction(boundaryFunction) {}
+                                                                 std::string labelName, bool timeIndependent)
+    : Ghost(boundaryFunction->GetName(), boundaryName, labelIds, EssentialGhostUpdate, this, labelName), boundaryFunction(boundaryFunction), timeIndependent(timeIndependent) {}
 PetscErrorCode ablate::flow::boundaryConditions::EssentialGhost::EssentialGhostUpdate(PetscReal time, const PetscReal *c, const PetscReal *n, const PetscScalar *a_xI, PetscScalar *a_xG, void *ctx) {
     // cast the pointer back to a math function
     ablate::flow::boundaryConditions::EssentialGhost *essentialGhost = (ablate::flow::boundaryConditions::EssentialGhost *)ctx;
 
     // Use the petsc function directly
     // PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx
-    return essentialGhost->boundaryFunction->GetSolutionField().GetPetscFunction()(
+    if (!essentialGhost->timeIndependent || !essentialGhost->domain) {
+        return essentialGhost->boundaryFunction->GetSolutionField().GetPetscFunction()(
+            essentialGhost->dim, time, c, essentialGhost->fieldSize, a_xG, essentialGhost->boundaryFunction->GetSolutionField().GetContext());
+    }
+
+    PetscFunctionBeginUser;
+    PetscErrorCode ierr;
+    if (!essentialGhost->cacheBuilt) {
+        ierr = essentialGhost->ComputeCachedGhostValues(time);
+        CHKERRQ(ierr);
+    }
+
+    // the centroid is copied from the face geometry, so it exactly matches the cached face centroid
+    auto cachedFace = essentialGhost->cachedFaceOffsets.find(essentialGhost->CentroidKey(c));
+    if (cachedFace != essentialGhost->cachedFaceOffsets.end()) {
+        ierr = PetscArraycpy(a_xG, &essentialGhost->cachedGhostValues[cachedFace->second], essentialGhost->fieldSize);
+        CHKERRQ(ierr);
+        PetscFunctionReturn(0);
+    }
+
+    // report the first miss so that a cache that is never used does not go unnoticed
+    if (essentialGhost->cacheMisses++ == 0) {
+        ierr = PetscInfo1(NULL, "Boundary %s face was not found in the time independent ghost cache and is computed directly\n", essentialGhost->GetBoundaryName().c_str());
+        CHKERRQ(ierr);
+    }
+
+    // any face that was not cached is computed directly
+    ierr = essentialGhost->boundaryFunction->GetSolutionField().GetPetscFunction()(
         essentialGhost->dim, time, c, essentialGhost->fieldSize, a_xG, essentialGhost->boundaryFunction->GetSolutionField().GetContext());
+    CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::flow::boundaryConditions::EssentialGhost::ComputeCachedGhostValues(PetscReal time) {
+    PetscFunctionBeginUser;
+    PetscErrorCode ierr;
+
+    Vec faceGeometry;
+    ierr = DMPlexGetGeometryFVM(domain, &faceGeometry, NULL, NULL);
+    CHKERRQ(ierr);
+    DM faceDM;
+    ierr = VecGetDM(faceGeometry, &faceDM);
+    CHKERRQ(ierr);
+    const PetscScalar *faceGeometryArray;
+    ierr = VecGetArrayRead(faceGeometry, &faceGeometryArray);
+    CHKERRQ(ierr);
+
+    PetscInt faceStart, faceEnd;
+    ierr = DMPlexGetHeightStratum(domain, 1, &faceStart, &faceEnd);
+    CHKERRQ(ierr);
+    cachedFaceOffsets.clear();
+    cachedGhostValues.clear();
+
+    DMLabel label;
+    ierr = DMGetLabel(domain, labelName.c_str(), &label);
+    CHKERRQ(ierr);
+    for (const auto &labelId : label ? labelIds : std::vector<int>{}) {
+        IS faceIS;
+        ierr = DMLabelGetStratumIS(label, labelId, &faceIS);
+        CHKERRQ(ierr);
+        if (!faceIS) {
+            continue;
+        }
+        PetscInt numberFaces;
+        const PetscInt *faces;
+        ierr = ISGetLocalSize(faceIS, &numberFaces);
+        CHKERRQ(ierr);
+        ierr = ISGetIndices(faceIS, &faces);
+        CHKERRQ(ierr);
+        for (PetscInt f = 0; f < numberFaces; ++f) {
+            const PetscInt face = faces[f];
+            if (face < faceStart || face >= faceEnd) {
+                continue;
+            }
+            PetscFVFaceGeom *faceGeom;
+            ierr = DMPlexPointLocalRead(faceDM, face, faceGeometryArray, &faceGeom);
+            CHKERRQ(ierr);
+            const auto key = CentroidKey(faceGeom->centroid);
+            if (cachedFaceOffsets.count(key)) {
+                continue;
+            }
+            const std::size_t offset = cachedGhostValues.size();
+            cachedGhostValues.resize(offset + fieldSize);
+            ierr = boundaryFunction->GetSolutionField().GetPetscFunction()(
+                dim, time, faceGeom->centroid, fieldSize, &cachedGhostValues[offset], boundaryFunction->GetSolutionField().GetContext());
+            CHKERRQ(ierr);
+            cachedFaceOffsets[key] = offset;
+        }
+        ierr = ISRestoreIndices(faceIS, &faces);
+        CHKERRQ(ierr);
+        ierr = ISDestroy(&faceIS);
+        CHKERRQ(ierr);
+    }
+
+    ierr = VecRestoreArrayRead(faceGeometry, &faceGeometryArray);
+    CHKERRQ(ierr);
+    cacheBuilt = true;
+    PetscFunctionReturn(0);
+}
+
+std::array<PetscReal, 3> ablate::flow::boundaryConditions::EssentialGhost::CentroidKey(const PetscReal *centroid) const {
+    std::array<PetscReal, 3> key = {0.0, 0.0, 0.0};
+    for (PetscInt d = 0; d < dim; d++) {
+        key[d] = centroid[d];
+    }
+    return key;
+}
+
+void ablate::flow::boundaryConditions::EssentialGhost::UpdateDomain(DM dm) {
+    // the cache is rebuilt on the next update with the new face numbering
+    domain = dm;
+    cacheBuilt = false;
+    cacheMisses = 0;
+    cachedFaceOffsets.clear();
+    cachedGhostValues.clear();
 }
 
 #include "parser/registrar.hpp"
 REGISTER(ablate::flow::boundaryConditions::BoundaryCondition, ablate::flow::boundaryConditions::EssentialGhost, "essential (Dirichlet condition) for ghost cell based boundaries",
          ARG(std::string, "boundaryName", "the name for this boundary condition"), ARG(std::vector<int>, "labelIds", "the ids on the mesh to apply the boundary condition"),
          ARG(ablate::mathFunctions::FieldFunction, "boundaryValue", "the field function used to describe the boundary"),
-         OPT(std::string, "labelName", "the mesh label holding the boundary ids (default Face Sets)"));
\ No newline at end of file
+         OPT(std::string, "labelName", "the mesh label holding the boundary ids (default Face Sets)"),
+         OPT(bool, "timeIndependent", "the boundary value does not change with time so the ghost values are only computed once for each face (default is false)"));
@@ -1,7 +1,10 @@
 #ifndef ABLATELIBRARY_ESSENTIALGHOST_HPP
 #define ABLATELIBRARY_ESSENTIALGHOST_HPP
 
+#include <array>
+#include <map>
 #include <mathFunctions/fieldFunction.hpp>
+#include <vector>
 #include "ghost.hpp"
 
 namespace ablate::flow::boundaryConditions {
@@ -12,8 +15,37 @@ class EssentialGhost : public Ghost {
 
     const std::shared_ptr<ablate::mathFunctions::FieldFunction> boundaryFunction;
 
+    // when the boundary function does not depend upon time, the ghost values are computed once for each boundary face of the domain
+    const bool timeIndependent;
+    DM domain = nullptr;
+
+    // the ghost value offset for each cached face, keyed by the face centroid that is passed to the update function
+    bool cacheBuilt = false;
+    std::map<std::array<PetscReal, 3>, std::size_t> cachedFaceOffsets;
+    std::vector<PetscScalar> cachedGhostValues;
+
+    // the number of updates, after the cache was built, that were not found in the cache and were computed directly
+    PetscInt cacheMisses = 0;
+
+    /**
+     * Returns the cache key for a face centroid
+     * @param centroid
+     * @return
+     */
+    std::array<PetscReal, 3> CentroidKey(const PetscReal* centroid) const;
+
+    /**
+     * Computes the ghost values for each face in the boundary label from the domain face geometry
+     * @param time
+     * @return
+     */
+    PetscErrorCode ComputeCachedGhostValues(PetscReal time);
+
    public:
-    EssentialGhost(std::string boundaryName, std::vector<int> labelId, std::shared_ptr<ablate::mathFunctions::FieldFunction> boundaryFunction, std::string labelName = {});
+    EssentialGhost(std::string boundaryName, std::vector<int> labelId, std::shared_ptr<ablate::mathFunctions::FieldFunction> boundaryFunction, std::string labelName = {},
+                   bool timeIndependent = false);
+
+    void UpdateDomain(DM dm) override;
 };
 }  // namespace ablate::flow::boundaryConditions
 #endif  // ABLATELIBRARY_ESSENTIALGHOST_HPP
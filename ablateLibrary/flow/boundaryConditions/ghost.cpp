@@ -4,7 +4,7 @@
 
 ablate::flow::boundaryConditions::Ghost::Ghost(std::string fieldName, std::string boundaryName, std::vector<int> labelIds, ablate::flow::boundaryConditions::Ghost::UpdateFunction updateFunction,
                                                void *updateContext, std::string labelNameIn)
-    : BoundaryCondition(boundaryName, fieldName), labelName(labelNameIn.empty() ? "Face Sets" : labelNameIn), labelIds(labelIds), updateFunction(updateFunction), updateContext(updateContext) {}
+    : BoundaryCondition(boundaryName, fieldName), updateFunction(updateFunction), updateContext(updateContext), labelName(labelNameIn.empty() ? "Face Sets" : labelNameIn), labelIds(labelIds) {}
 
 ablate::flow::boundaryConditions::Ghost::Ghost(std::string fieldName, std::string boundaryName, int labelId, ablate::flow::boundaryConditions::Ghost::UpdateFunction updateFunction,
                                                void *updateContext, std::string labelName)
@@ -9,12 +9,13 @@ class Ghost : public BoundaryCondition {
     typedef PetscErrorCode (*UpdateFunction)(PetscReal time, const PetscReal* c, const PetscReal* n, const PetscScalar* a_xI, PetscScalar* a_xG, void* ctx);
 
    private:
-    const std::string labelName;
-    const std::vector<int> labelIds;
     const UpdateFunction updateFunction;
     const void* updateContext;
 
    protected:
+    const std::string labelName;
+    const std::vector<int> labelIds;
+
     // Store some field information
     PetscInt dim;
     PetscInt fieldSize;
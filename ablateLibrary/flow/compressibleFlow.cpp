@@ -1,6 +1,7 @@
 #include "compressibleFlow.hpp"
 #include <flow/processes/eulerAdvection.hpp>
 #include <flow/processes/eulerDiffusion.hpp>
+#include <flow/processes/implicitProcess.hpp>
 #include <flow/processes/speciesDiffusion.hpp>
 #include <utilities/mpiError.hpp>
 
@@ -24,15 +25,18 @@ ablate::flow::CompressibleFlow::CompressibleFlow(std::string name, std::shared_p
              {
                  // create assumed processes for compressible flow
                  std::make_shared<ablate::flow::processes::EulerAdvection>(parameters, eosIn, fluxCalculatorIn),
-                 std::make_shared<ablate::flow::processes::EulerDiffusion>(eosIn, transport),
-                 std::make_shared<ablate::flow::processes::SpeciesDiffusion>(eosIn, transport),
+                 // the diffusion processes can optionally be integrated implicitly
+                 ablate::flow::processes::ImplicitProcess::Wrap(std::make_shared<ablate::flow::processes::EulerDiffusion>(eosIn, transport),
+                                                                parameters && parameters->Get<bool>("implicitDiffusion", false)),
+                 ablate::flow::processes::ImplicitProcess::Wrap(std::make_shared<ablate::flow::processes::SpeciesDiffusion>(eosIn, transport),
+                                                                parameters && parameters->Get<bool>("implicitDiffusion", false)),
              },
              options, initialization, boundaryConditions, {}, exactSolutions) {}
 
 #include "parser/registrar.hpp"
 REGISTER(ablate::flow::Flow, ablate::flow::CompressibleFlow, "compressible finite volume flow", ARG(std::string, "name", "the name of the flow field"),
          ARG(ablate::mesh::Mesh, "mesh", "the  mesh and discretization"), ARG(ablate::eos::EOS, "eos", "the equation of state used to describe the flow"),
-         ARG(ablate::parameters::Parameters, "parameters", "the compressible flow parameters cfl, gamma, etc."),
+         ARG(ablate::parameters::Parameters, "parameters", "the compressible flow parameters cfl, gamma, implicitDiffusion, etc."),
          OPT(ablate::eos::transport::TransportModel, "transport", "the diffusion transport model"),
          OPT(ablate::flow::fluxCalculator::FluxCalculator, "fluxCalculator", "the flux calculators (defaults to AUSM)"), OPT(ablate::parameters::Parameters, "options", "the options passed to PETSc"),
          OPT(std::vector<mathFunctions::FieldFunction>, "initialization", "the flow field initialization"),
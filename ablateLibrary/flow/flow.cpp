@@ -254,6 +254,7 @@ void ablate::flow::Flow::CompleteProblemSetup(TS ts) {
 
         // Setup the boundary condition
         boundary->SetupBoundary(prob, fieldId.value());
+        boundary->UpdateDomain(dm->GetDomain());
     }
 
     // Setup the solve with the ts
@@ -338,6 +339,8 @@ void ablate::flow::Flow::CompleteProblemSetup(TS ts) {
     }
 }
 
+void ablate::flow::Flow::ComputeRHSFunction(TS ts, PetscReal time, Vec u, Vec rhs) { TSComputeRHSFunction(ts, time, u, rhs) >> checkError; }
+
 /**
  * Static function that is called by the flow object to update the aux variables if an aux variable soltuion was provided
  * @param ts
@@ -54,6 +54,7 @@ class Flow : public solve::Solvable, public monitors::Viewable {
     std::vector<std::function<void(TS ts, Flow&, PetscReal)>> preStageFunctions;
     std::vector<std::function<void(TS ts, Flow&)>> postStepFunctions;
     std::vector<std::function<void(TS ts, Flow&)>> postEvaluateFunctions;
+    std::vector<std::function<void(TS ts, Flow&)>> postRepartitionFunctions;
 
     const std::vector<std::shared_ptr<mathFunctions::FieldFunction>> initialization;
     const std::vector<std::shared_ptr<boundaryConditions::BoundaryCondition>> boundaryConditions;
@@ -79,6 +80,16 @@ class Flow : public solve::Solvable, public monitors::Viewable {
     virtual void CompleteProblemSetup(TS ts);
     virtual void CompleteFlowInitialization(DM, Vec){};
 
+    /**
+     * Computes the rhs of the flow for the solution u.  Unlike the rhs used to advance the ts, this is the rhs of the governing equations, so it can be
+     * used as the residual of a steady state problem.
+     * @param ts
+     * @param time
+     * @param u
+     * @param rhs
+     */
+    virtual void ComputeRHSFunction(TS ts, PetscReal time, Vec u, Vec rhs);
+
     /**
      * function to update the aux fields.
      */
@@ -117,6 +128,12 @@ class Flow : public solve::Solvable, public monitors::Viewable {
      */
     void RegisterPostEvaluate(std::function<void(TS ts, Flow&)> postEval) { this->postEvaluateFunctions.push_back(postEval); }
 
+    /**
+     * Adds function to be called after the flow dm has been repartitioned.  Any object holding a copy of the dm or flow vectors should rebuild them here.
+     * @param postRepartition
+     */
+    void RegisterPostRepartition(std::function<void(TS ts, Flow&)> postRepartition) { this->postRepartitionFunctions.push_back(postRepartition); }
+
     const std::string& GetName() const override { return name; }
 
     const DM& GetDM() const { return dm->GetDomain(); }
@@ -127,6 +144,12 @@ class Flow : public solve::Solvable, public monitors::Viewable {
 
     Vec GetAuxField() { return auxField; }
 
+    /**
+     * Returns the global flow solution owned by the flow (do not destroy it).  The vector is replaced when the flow is repartitioned, so any copy must be
+     * requested again in a RegisterPostRepartition function.  The vector returned before the first repartition stays valid (with the old layout) until the
+     * flow is destroyed, because it is the vector handed to TSSolve.
+     * @return
+     */
     Vec GetSolutionVector() override { return flowField; }
 
     std::optional<int> GetFieldId(const std::string& fieldName) const;
@@ -7,7 +7,26 @@ ablate::flow::FVFlow::FVFlow(std::string name, std::shared_ptr<mesh::Mesh> mesh,
                              std::vector<std::shared_ptr<processes::FlowProcess>> flowProcessesIn, std::shared_ptr<parameters::Parameters> options,
                              std::vector<std::shared_ptr<mathFunctions::FieldFunction>> initialization, std::vector<std::shared_ptr<boundaryConditions::BoundaryCondition>> boundaryConditions,
                              std::vector<std::shared_ptr<mathFunctions::FieldFunction>> auxiliaryFields, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolution)
-    : Flow(name, mesh, parameters, options, initialization, boundaryConditions, auxiliaryFields, exactSolution), flowProcesses(flowProcessesIn) {
+    : Flow(name, mesh, parameters, options, initialization, boundaryConditions, auxiliaryFields, exactSolution),
+      flowProcesses(flowProcessesIn),
+      baseDM(nullptr),
+      initialFlowField(nullptr),
+      repartitionInterval(parameters ? parameters->Get<PetscInt>("repartitionInterval", 0) : 0),
+      repartitionImbalance(parameters ? parameters->Get<PetscReal>("repartitionImbalance", 0.0) : 0.0) {
+    // register the log events used by the flow
+    PetscLogEventGetId("FVFlowRHS", &rhsLogEvent) >> checkError;
+    if (rhsLogEvent < 0) {
+        PetscLogEventRegister("FVFlowRHS", DM_CLASSID, &rhsLogEvent) >> checkError;
+    }
+    PetscLogEventGetId("FVInsertBoundary", &boundaryLogEvent) >> checkError;
+    if (boundaryLogEvent < 0) {
+        PetscLogEventRegister("FVInsertBoundary", DM_CLASSID, &boundaryLogEvent) >> checkError;
+    }
+    PetscLogEventGetId("FVFlowIFunction", &implicitLogEvent) >> checkError;
+    if (implicitLogEvent < 0) {
+        PetscLogEventRegister("FVFlowIFunction", DM_CLASSID, &implicitLogEvent) >> checkError;
+    }
+
     // make sure that the dm works with fv
     const PetscInt ghostCellDepth = 1;
     DM& dm = this->dm->GetDomain();
@@ -21,11 +40,15 @@ ablate::flow::FVFlow::FVFlow(std::string name, std::shared_ptr<mesh::Mesh> mesh,
         }
     }
 
-    // create any ghost cells that are needed
+    // create any ghost cells that are needed, hold onto the base dm if it is needed for repartitioning
     {
         DM gdm;
         DMPlexConstructGhostCells(dm, NULL, NULL, &gdm) >> checkError;
-        DMDestroy(&dm) >> checkError;
+        if (repartitionInterval > 0) {
+            baseDM = dm;
+        } else {
+            DMDestroy(&dm) >> checkError;
+        }
         dm = gdm;
     }
 
@@ -68,18 +91,33 @@ ablate::flow::FVFlow::FVFlow(std::string name, std::shared_ptr<mesh::Mesh> mesh,
           }(fieldDescriptors),
           flowProcessesIn, options, initialization, boundaryConditions, auxiliaryFields, exactSolution) {}
 
+ablate::flow::FVFlow::~FVFlow() {
+    if (baseDM) {
+        DMDestroy(&baseDM) >> checkError;
+    }
+    if (initialFlowField) {
+        VecDestroy(&initialFlowField) >> checkError;
+    }
+}
+
 PetscErrorCode ablate::flow::FVFlow::FVRHSFunctionLocal(DM dm, PetscReal time, Vec locXVec, Vec globFVec, void* ctx) {
     PetscFunctionBeginUser;
     PetscErrorCode ierr;
 
     ablate::flow::FVFlow* flow = (ablate::flow::FVFlow*)ctx;
+    ierr = PetscLogEventBegin(flow->rhsLogEvent, dm, 0, 0, 0);
+    CHKERRQ(ierr);
 
     /* Handle non-essential (e.g. outflow) boundary values.  This should be done before the auxFields are updated so that boundary values can be updated */
     Vec facegeom, cellgeom;
     ierr = DMPlexGetGeometryFVM(dm, &facegeom, &cellgeom, NULL);
     CHKERRQ(ierr);
+    ierr = PetscLogEventBegin(flow->boundaryLogEvent, dm, 0, 0, 0);
+    CHKERRQ(ierr);
     ierr = DMPlexInsertBoundaryValues(dm, PETSC_FALSE, locXVec, time, facegeom, cellgeom, NULL);
     CHKERRQ(ierr);
+    ierr = PetscLogEventEnd(flow->boundaryLogEvent, dm, 0, 0, 0);
+    CHKERRQ(ierr);
 
     // update any aux fields, including ghost cells
     ierr = FVFlowUpdateAuxFieldsFV(flow->auxFieldUpdateFunctionDescriptions.size(), &flow->auxFieldUpdateFunctionDescriptions[0], flow->dm->GetDomain(), flow->auxDM, time, locXVec, flow->auxField);
@@ -102,8 +140,114 @@ PetscErrorCode ablate::flow::FVFlow::FVRHSFunctionLocal(DM dm, PetscReal time, V
         CHKERRQ(ierr);
     }
 
+    // if using local time stepping, scale the rhs in each cell so that it is advanced with its own dt
+    if (!flow->localTimeStepScale.empty()) {
+        PetscSection section;
+        ierr = DMGetLocalSection(dm, &section);
+        CHKERRQ(ierr);
+        PetscScalar* fArray;
+        ierr = VecGetArray(globFVec, &fArray);
+        CHKERRQ(ierr);
+        for (std::size_t i = 0; i < flow->localTimeStepScale.size(); i++) {
+            const PetscInt cell = flow->localTimeStepCellStart + (PetscInt)i;
+            PetscScalar* f;
+            ierr = DMPlexPointGlobalRef(dm, cell, fArray, &f);
+            CHKERRQ(ierr);
+            if (f) {
+                PetscInt dof;
+                ierr = PetscSectionGetDof(section, cell, &dof);
+                CHKERRQ(ierr);
+                for (PetscInt d = 0; d < dof; d++) {
+                    f[d] *= flow->localTimeStepScale[i];
+                }
+            }
+        }
+        ierr = VecRestoreArray(globFVec, &fArray);
+        CHKERRQ(ierr);
+    }
+
+    ierr = PetscLogEventEnd(flow->rhsLogEvent, dm, 0, 0, 0);
+    CHKERRQ(ierr);
     PetscFunctionReturn(0);
 }
+
+PetscErrorCode ablate::flow::FVFlow::FVIFunction(TS ts, PetscReal time, Vec U, Vec Udot, Vec F, void* ctx) {
+    PetscFunctionBeginUser;
+    PetscErrorCode ierr;
+
+    ablate::flow::FVFlow* flow = (ablate::flow::FVFlow*)ctx;
+    DM dm;
+    ierr = TSGetDM(ts, &dm);
+    CHKERRQ(ierr);
+    ierr = PetscLogEventBegin(flow->implicitLogEvent, dm, 0, 0, 0);
+    CHKERRQ(ierr);
+
+    // get the local solution with the ghost cell boundary values
+    Vec locXVec;
+    ierr = DMGetLocalVector(dm, &locXVec);
+    CHKERRQ(ierr);
+    ierr = VecZeroEntries(locXVec);
+    CHKERRQ(ierr);
+    ierr = DMGlobalToLocalBegin(dm, U, INSERT_VALUES, locXVec);
+    CHKERRQ(ierr);
+    ierr = DMGlobalToLocalEnd(dm, U, INSERT_VALUES, locXVec);
+    CHKERRQ(ierr);
+    Vec facegeom, cellgeom;
+    ierr = DMPlexGetGeometryFVM(dm, &facegeom, &cellgeom, NULL);
+    CHKERRQ(ierr);
+    ierr = DMPlexInsertBoundaryValues(dm, PETSC_FALSE, locXVec, time, facegeom, cellgeom, NULL);
+    CHKERRQ(ierr);
+
+    // the aux fields must be consistent with the implicit stage values
+    ierr = FVFlowUpdateAuxFieldsFV(flow->auxFieldUpdateFunctionDescriptions.size(), &flow->auxFieldUpdateFunctionDescriptions[0], dm, flow->auxDM, time, locXVec, flow->auxField);
+    CHKERRQ(ierr);
+
+    // compute the implicit part of the rhs
+    ierr = VecZeroEntries(F);
+    CHKERRQ(ierr);
+    if (!flow->implicitRhsFluxFunctionDescriptions.empty() || !flow->implicitRhsPointFunctionDescriptions.empty()) {
+        ierr = ABLATE_DMPlexComputeRHSFunctionFVM(&flow->implicitRhsFluxFunctionDescriptions[0],
+                                                  flow->implicitRhsFluxFunctionDescriptions.size(),
+                                                  &flow->implicitRhsPointFunctionDescriptions[0],
+                                                  flow->implicitRhsPointFunctionDescriptions.size(),
+                                                  dm,
+                                                  time,
+                                                  locXVec,
+                                                  F);
+        CHKERRQ(ierr);
+    }
+    for (const auto& rhsFunction : flow->implicitRhsArbitraryFunctions) {
+        ierr = rhsFunction.first(dm, time, locXVec, F, rhsFunction.second);
+        CHKERRQ(ierr);
+    }
+
+    // F = Udot - G
+    ierr = VecAYPX(F, -1.0, Udot);
+    CHKERRQ(ierr);
+
+    ierr = DMRestoreLocalVector(dm, &locXVec);
+    CHKERRQ(ierr);
+    ierr = PetscLogEventEnd(flow->implicitLogEvent, dm, 0, 0, 0);
+    CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+}
+
+void ablate::flow::FVFlow::SetupImplicitSolve(TS ts) {
+    DMTSSetIFunction(dm->GetDomain(), FVIFunction, this) >> checkError;
+
+    // The gradient reconstruction reaches past the face neighbors, so the matrix built from the cell adjacency cannot hold the full jacobian.  The
+    // jacobian is applied matrix free (the same as -snes_mf_operator) and only the preconditioner uses the face neighbor stencil, computed with
+    // finite differences using a coloring of that matrix.  Use -snes_mf to skip the preconditioner matrix (i.e. with -pc_type none).
+    SNES snes;
+    TSGetSNES(ts, &snes) >> checkError;
+    Mat jacobian;
+    MatCreateSNESMF(snes, &jacobian) >> checkError;
+    Mat preconditioner;
+    DMCreateMatrix(dm->GetDomain(), &preconditioner) >> checkError;
+    SNESSetJacobian(snes, jacobian, preconditioner, SNESComputeJacobianDefaultColor, NULL) >> checkError;
+    MatDestroy(&preconditioner) >> checkError;
+    MatDestroy(&jacobian) >> checkError;
+}
 void ablate::flow::FVFlow::CompleteProblemSetup(TS ts) {
     Flow::CompleteProblemSetup(ts);
 
@@ -143,10 +287,50 @@ void ablate::flow::FVFlow::CompleteProblemSetup(TS ts) {
         }
     }
 
+    // the time step and load imbalance reductions are started together at the end of the previous step so they overlap the monitors and output
+    if (repartitionInterval > 0 || !timeStepFunctions.empty()) {
+        stepReduction = std::make_unique<utilities::ReductionAggregator>(PetscObjectComm((PetscObject)dm->GetDomain()));
+        preStepFunctions.push_back(PrepareStepReductions);
+    }
+
+    // repartition before the time step is set.  The global min dt does not depend upon the layout so it can be reduced before repartitioning
+    if (repartitionInterval > 0) {
+        preStepFunctions.push_back(Repartition);
+    }
+
     if (!timeStepFunctions.empty()) {
         preStepFunctions.push_back(ComputeTimeStep);
     }
+
+    // any processes that are treated implicitly are evaluated through the IFunction
+    if (HasImplicitFunctions()) {
+        SetupImplicitSolve(ts);
+    }
+
+    // check to see if each cell should be advanced with its own time step.  This is only valid for steady state problems
+    const char* tsPrefix;
+    TSGetOptionsPrefix(ts, &tsPrefix) >> checkError;
+    PetscBool localTimeStepping = PETSC_FALSE;
+    PetscOptionsGetBool(NULL, tsPrefix, "-ts_local_time_stepping", &localTimeStepping, NULL) >> checkError;
+    if (localTimeStepping) {
+        if (localTimeStepFunctions.empty()) {
+            throw std::invalid_argument("Local time stepping requires at least one process that computes a local time step for flow " + GetName());
+        }
+        if (HasImplicitFunctions()) {
+            throw std::invalid_argument("Local time stepping cannot be used with implicit processes in flow " + GetName());
+        }
+        preStepFunctions.push_back(ComputeLocalTimeStep);
+    }
+}
+void ablate::flow::FVFlow::ComputeRHSFunction(TS ts, PetscReal time, Vec u, Vec rhs) {
+    // the local time step scale is only used to advance the solution, so remove it while the rhs is evaluated
+    std::vector<PetscReal> scale;
+    std::swap(scale, localTimeStepScale);
+    PetscErrorCode ierr = TSComputeRHSFunction(ts, time, u, rhs);
+    std::swap(scale, localTimeStepScale);
+    ierr >> checkError;
 }
+
 void ablate::flow::FVFlow::RegisterRHSFunction(FVMRHSFluxFunction function, void* context, std::string field, std::vector<std::string> inputFields, std::vector<std::string> auxFields) {
     // map the field, inputFields, and auxFields to locations
     auto fieldId = this->GetFieldId(field);
@@ -183,7 +367,7 @@ void ablate::flow::FVFlow::RegisterRHSFunction(FVMRHSFluxFunction function, void
         functionDescription.auxFields[i] = auxFieldId.value();
     }
 
-    rhsFluxFunctionDescriptions.push_back(functionDescription);
+    (registerImplicit ? implicitRhsFluxFunctionDescriptions : rhsFluxFunctionDescriptions).push_back(functionDescription);
 }
 
 void ablate::flow::FVFlow::RegisterRHSFunction(FVMRHSPointFunction function, void* context, std::vector<std::string> fields, std::vector<std::string> inputFields, std::vector<std::string> auxFields) {
@@ -225,10 +409,23 @@ void ablate::flow::FVFlow::RegisterRHSFunction(FVMRHSPointFunction function, voi
         functionDescription.auxFields[i] = fieldId.value();
     }
 
-    rhsPointFunctionDescriptions.push_back(functionDescription);
+    (registerImplicit ? implicitRhsPointFunctionDescriptions : rhsPointFunctionDescriptions).push_back(functionDescription);
 }
 
-void ablate::flow::FVFlow::RegisterRHSFunction(RHSArbitraryFunction function, void* context) { rhsArbitraryFunctions.push_back(std::make_pair(function, context)); }
+void ablate::flow::FVFlow::RegisterRHSFunction(RHSArbitraryFunction function, void* context) {
+    (registerImplicit ? implicitRhsArbitraryFunctions : rhsArbitraryFunctions).push_back(std::make_pair(function, context));
+}
+
+void ablate::flow::FVFlow::InitializeImplicitProcess(processes::FlowProcess& process) {
+    registerImplicit = true;
+    try {
+        process.Initialize(*this);
+    } catch (...) {
+        registerImplicit = false;
+        throw;
+    }
+    registerImplicit = false;
+}
 
 void ablate::flow::FVFlow::RegisterAuxFieldUpdate(FVAuxFieldUpdateFunction function, void* context, std::string auxField, std::vector<std::string> inputFields) {
     // find the field location
@@ -255,10 +452,57 @@ void ablate::flow::FVFlow::RegisterAuxFieldUpdate(FVAuxFieldUpdateFunction funct
     auxFieldUpdateFunctionDescriptions.push_back(functionDescription);
 }
 
+void ablate::flow::FVFlow::StartStepReductions(TS ts, ablate::flow::Flow& flow) {
+    ablate::flow::FVFlow& flowFV = dynamic_cast<ablate::flow::FVFlow&>(flow);
+    flowFV.stepReduction->Reset();
+
+    // march over each calculator
+    if (!flowFV.timeStepFunctions.empty()) {
+        PetscReal dtMin = 1000.0;
+        for (const auto& dtFunction : flowFV.timeStepFunctions) {
+            dtMin = PetscMin(dtMin, dtFunction.first(ts, flow, dtFunction.second));
+        }
+        flowFV.timeStepReductionIndex = flowFV.stepReduction->Add(dtMin, utilities::ReductionAggregator::Operation::MIN);
+    }
+
+    // compute the local weight if this step may be repartitioned
+    flowFV.repartitionCellWeights.clear();
+    if (flowFV.IsRepartitionStep(ts)) {
+        PetscInt cEnd;
+        flowFV.repartitionCellWeights = flowFV.ComputeCellWeights(flowFV.repartitionCellStart, cEnd);
+        if (flowFV.repartitionImbalance > 0.0) {
+            PetscReal localWeight = 0.0;
+            for (const auto& weight : flowFV.repartitionCellWeights) {
+                localWeight += weight;
+            }
+            flowFV.maxWeightReductionIndex = flowFV.stepReduction->Add(localWeight, utilities::ReductionAggregator::Operation::MAX);
+            flowFV.totalWeightReductionIndex = flowFV.stepReduction->Add(localWeight, utilities::ReductionAggregator::Operation::SUM);
+        }
+    }
+
+    flowFV.stepReduction->Start();
+    TSGetStepNumber(ts, &flowFV.stepReductionStep) >> checkError;
+}
+
+void ablate::flow::FVFlow::PrepareStepReductions(TS ts, ablate::flow::Flow& flow) {
+    ablate::flow::FVFlow& flowFV = dynamic_cast<ablate::flow::FVFlow&>(flow);
+
+    // the first step has no previous step to start the reductions
+    PetscInt step;
+    TSGetStepNumber(ts, &step) >> checkError;
+    if (flowFV.stepReductionStep != step) {
+        StartStepReductions(ts, flow);
+    }
+
+    // Every other post step function (i.e. particle advection that changes the cell weights) is registered once the solve starts, so the reductions for the next
+    // step can be started last in the post step.  They complete while the ts monitors run, and the step number is already that of the next step.
+    if (!flowFV.stepReductionPostStep) {
+        flowFV.postStepFunctions.push_back(StartStepReductions);
+        flowFV.stepReductionPostStep = true;
+    }
+}
+
 void ablate::flow::FVFlow::ComputeTimeStep(TS ts, ablate::flow::Flow& flow) {
-    // Get the dm and current solution vector
-    DM dm;
-    TSGetDM(ts, &dm) >> checkError;
     PetscInt timeStep;
     TSGetStepNumber(ts, &timeStep) >> checkError;
     PetscReal currentDt;
@@ -267,18 +511,8 @@ void ablate::flow::FVFlow::ComputeTimeStep(TS ts, ablate::flow::Flow& flow) {
     // Get the flow param
     ablate::flow::FVFlow& flowFV = dynamic_cast<ablate::flow::FVFlow&>(flow);
 
-    // march over each calculator
-    PetscReal dtMin = 1000.0;
-    for (const auto& dtFunction : flowFV.timeStepFunctions) {
-        dtMin = PetscMin(dtMin, dtFunction.first(ts, flow, dtFunction.second));
-    }
-
-    // take the min across all ranks
-    PetscInt rank;
-    MPI_Comm_rank(PetscObjectComm((PetscObject)ts), &rank);
-
-    PetscReal dtMinGlobal;
-    MPI_Allreduce(&dtMin, &dtMinGlobal, 1, MPIU_REAL, MPI_MIN, PetscObjectComm((PetscObject)ts)) >> checkMpiError;
+    // the min across all ranks was started at the end of the previous step
+    PetscReal dtMinGlobal = flowFV.stepReduction->Get(flowFV.timeStepReductionIndex);
 
     // don't override the first time step if bigger
     if (timeStep > 0 || dtMinGlobal < currentDt) {
@@ -288,7 +522,327 @@ void ablate::flow::FVFlow::ComputeTimeStep(TS ts, ablate::flow::Flow& flow) {
         }
     }
 }
-void ablate::flow::FVFlow::RegisterComputeTimeStepFunction(ComputeTimeStepFunction function, void* ctx) { timeStepFunctions.push_back(std::make_pair(function, ctx)); }
+void ablate::flow::FVFlow::RegisterComputeTimeStepFunction(ComputeTimeStepFunction function, void* ctx) {
+    // implicit processes do not limit the time step
+    if (!registerImplicit) {
+        timeStepFunctions.push_back(std::make_pair(function, ctx));
+    }
+}
+
+void ablate::flow::FVFlow::RegisterComputeLocalTimeStepFunction(ComputeLocalTimeStepFunction function, void* ctx) {
+    if (!registerImplicit) {
+        localTimeStepFunctions.push_back(std::make_pair(function, ctx));
+    }
+}
+
+void ablate::flow::FVFlow::ComputeLocalTimeStep(TS ts, ablate::flow::Flow& flow) {
+    ablate::flow::FVFlow& flowFV = dynamic_cast<ablate::flow::FVFlow&>(flow);
+
+    // compute the min dt in each cell from each function
+    PetscInt cStart, cEnd;
+    DMPlexGetSimplexOrBoxCells(flowFV.GetDM(), 0, &cStart, &cEnd) >> checkError;
+    std::vector<PetscReal> cellDt(cEnd - cStart, PETSC_MAX_REAL);
+    for (const auto& dtFunction : flowFV.localTimeStepFunctions) {
+        dtFunction.first(ts, flow, cStart, cEnd, &cellDt[0], dtFunction.second);
+    }
+
+    // the ts takes a step of dt, so scale each cell by its local dt
+    PetscReal dt;
+    TSGetTimeStep(ts, &dt) >> checkError;
+    flowFV.localTimeStepCellStart = cStart;
+    flowFV.localTimeStepScale.resize(cellDt.size());
+    for (std::size_t i = 0; i < cellDt.size(); i++) {
+        flowFV.localTimeStepScale[i] = cellDt[i] < PETSC_MAX_REAL ? cellDt[i] / dt : 1.0;
+    }
+}
+
+void ablate::flow::FVFlow::RegisterComputeCellWeightFunction(ComputeCellWeightFunction function, void* ctx) { cellWeightFunctions.push_back(std::make_pair(function, ctx)); }
+
+std::vector<PetscReal> ablate::flow::FVFlow::ComputeCellWeights(PetscInt& cStart, PetscInt& cEnd) const {
+    // only consider the interior cells
+    DMPlexGetHeightStratum(GetDM(), 0, &cStart, &cEnd) >> checkError;
+    PetscInt ghostStart;
+    DMPlexGetGhostCellStratum(GetDM(), &ghostStart, NULL) >> checkError;
+    if (ghostStart >= 0) {
+        cEnd = ghostStart;
+    }
+
+    // the global section is used to determine which cells are owned by this rank
+    PetscSection globalSection;
+    DMGetGlobalSection(GetDM(), &globalSection) >> checkError;
+
+    std::vector<PetscReal> cellWeights(cEnd - cStart, 0.0);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscInt globalDof;
+        PetscSectionGetDof(globalSection, c, &globalDof) >> checkError;
+        if (globalDof <= 0) {
+            continue;
+        }
+
+        // each cell has a base cost of one (the rhs evaluation)
+        PetscReal weight = 1.0;
+        for (const auto& weightFunction : cellWeightFunctions) {
+            weight += weightFunction.first(const_cast<FVFlow&>(*this), c, weightFunction.second);
+        }
+        cellWeights[c - cStart] = weight;
+    }
+    return cellWeights;
+}
+
+bool ablate::flow::FVFlow::IsRepartitionStep(TS ts) const {
+    // only check at the repartition interval
+    PetscInt timeStep;
+    TSGetStepNumber(ts, &timeStep) >> checkError;
+    if (repartitionInterval <= 0 || timeStep == 0 || timeStep % repartitionInterval != 0) {
+        return false;
+    }
+
+    PetscMPIInt size;
+    MPI_Comm_size(PetscObjectComm((PetscObject)GetDM()), &size) >> checkMpiError;
+    return size > 1;
+}
+
+void ablate::flow::FVFlow::Repartition(TS ts, ablate::flow::Flow& flow) {
+    ablate::flow::FVFlow& flowFV = dynamic_cast<ablate::flow::FVFlow&>(flow);
+
+    if (!flowFV.IsRepartitionStep(ts)) {
+        return;
+    }
+
+    // the cell weights were computed at the start of the step
+    PetscInt cStart = flowFV.repartitionCellStart;
+    auto cellWeights = std::move(flowFV.repartitionCellWeights);
+    flowFV.repartitionCellWeights.clear();
+
+    // if an imbalance threshold is provided, only repartition when it is exceeded
+    if (flowFV.repartitionImbalance > 0.0) {
+        PetscMPIInt size;
+        MPI_Comm_size(PetscObjectComm((PetscObject)flowFV.GetDM()), &size) >> checkMpiError;
+        PetscReal maxWeight = flowFV.stepReduction->Get(flowFV.maxWeightReductionIndex);
+        PetscReal totalWeight = flowFV.stepReduction->Get(flowFV.totalWeightReductionIndex);
+        PetscReal imbalance = maxWeight / (totalWeight / size);
+
+        PetscInfo2(NULL, "Flow %s load imbalance %g\n", flowFV.GetName().c_str(), (double)imbalance) >> checkError;
+        if (imbalance < flowFV.repartitionImbalance) {
+            return;
+        }
+    }
+
+    flowFV.RedistributeMesh(ts, cStart, cellWeights);
+
+    // let everything else know that the dm has changed
+    for (const auto& function : flowFV.postRepartitionFunctions) {
+        function(ts, flow);
+    }
+}
+
+/**
+ * Copies the interior cell values from a dm with ghost cells into a clone of the base dm and distributes them using the migrationSF
+ */
+static void DistributeCellField(DM fromDM, Vec fromLocalVec, PetscInt cStart, PetscInt cEnd, DM baseDM, PetscSF migrationSF, PetscSection* newSection, Vec* newVec) {
+    // create a copy of the base dm with the same fields as the from dm
+    DM baseFieldDM;
+    DMClone(baseDM, &baseFieldDM) >> checkError;
+    DMCopyDisc(fromDM, baseFieldDM) >> checkError;
+    PetscSection baseSection;
+    DMGetLocalSection(baseFieldDM, &baseSection) >> checkError;
+    Vec baseVec;
+    DMCreateLocalVector(baseFieldDM, &baseVec) >> checkError;
+
+    // the interior cells have the same numbering in both dms
+    const PetscScalar* fromArray;
+    PetscScalar* baseArray;
+    VecGetArrayRead(fromLocalVec, &fromArray) >> checkError;
+    VecGetArray(baseVec, &baseArray) >> checkError;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        const PetscScalar* fromValues;
+        PetscScalar* baseValues;
+        PetscInt dof;
+        DMPlexPointLocalRead(fromDM, c, fromArray, &fromValues) >> checkError;
+        DMPlexPointLocalRef(baseFieldDM, c, baseArray, &baseValues) >> checkError;
+        PetscSectionGetDof(baseSection, c, &dof) >> checkError;
+        PetscArraycpy(baseValues, fromValues, dof) >> checkError;
+    }
+    VecRestoreArrayRead(fromLocalVec, &fromArray) >> checkError;
+    VecRestoreArray(baseVec, &baseArray) >> checkError;
+
+    // distribute the values to the new layout
+    PetscSectionCreate(PETSC_COMM_SELF, newSection) >> checkError;
+    VecCreate(PETSC_COMM_SELF, newVec) >> checkError;
+    DMPlexDistributeField(baseFieldDM, migrationSF, baseSection, baseVec, *newSection, *newVec) >> checkError;
+
+    VecDestroy(&baseVec) >> checkError;
+    DMDestroy(&baseFieldDM) >> checkError;
+}
+
+/**
+ * Copies the distributed cell values into the interior cells of the new dm. Only owned values are copied into global vectors.
+ */
+static void CopyDistributedCellField(PetscSection section, Vec vec, DM toDM, Vec toVec, PetscBool global) {
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(toDM, 0, &cStart, &cEnd) >> checkError;
+    PetscInt ghostStart;
+    DMPlexGetGhostCellStratum(toDM, &ghostStart, NULL) >> checkError;
+    if (ghostStart >= 0) {
+        cEnd = ghostStart;
+    }
+
+    const PetscScalar* fromArray;
+    PetscScalar* toArray;
+    VecGetArrayRead(vec, &fromArray) >> checkError;
+    VecGetArray(toVec, &toArray) >> checkError;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscScalar* toValues = NULL;
+        if (global) {
+            DMPlexPointGlobalRef(toDM, c, toArray, &toValues) >> checkError;
+        } else {
+            DMPlexPointLocalRef(toDM, c, toArray, &toValues) >> checkError;
+        }
+        if (toValues) {
+            PetscInt offset, dof;
+            PetscSectionGetOffset(section, c, &offset) >> checkError;
+            PetscSectionGetDof(section, c, &dof) >> checkError;
+            PetscArraycpy(toValues, fromArray + offset, dof) >> checkError;
+        }
+    }
+    VecRestoreArrayRead(vec, &fromArray) >> checkError;
+    VecRestoreArray(toVec, &toArray) >> checkError;
+}
+
+void ablate::flow::FVFlow::RedistributeMesh(TS ts, PetscInt cStart, const std::vector<PetscReal>& cellWeights) {
+    const PetscInt ghostCellDepth = 1;
+    DM& dm = this->dm->GetDomain();
+    const PetscInt cEnd = cStart + (PetscInt)cellWeights.size();
+
+    // Create a copy of the base dm that uses the cell weights as the local section.  These are used as vertex weights by the partitioner
+    DM weightDM;
+    DMClone(baseDM, &weightDM) >> checkError;
+    PetscSection weightSection;
+    PetscSectionCreate(PETSC_COMM_SELF, &weightSection) >> checkError;
+    PetscInt pStart, pEnd;
+    DMPlexGetChart(baseDM, &pStart, &pEnd) >> checkError;
+    PetscSectionSetChart(weightSection, pStart, pEnd) >> checkError;
+    // the partitioner only accepts integer weights, so scale the fractional costs before rounding
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscSectionSetDof(weightSection, c, PetscMax(1, (PetscInt)PetscRoundReal(cellWeights[c - cStart] * cellWeightResolution))) >> checkError;
+    }
+    PetscSectionSetUp(weightSection) >> checkError;
+    DMSetLocalSection(weightDM, weightSection) >> checkError;
+    PetscSectionDestroy(&weightSection) >> checkError;
+
+    // not every partitioner uses the vertex weights
+    PetscPartitioner partitioner;
+    DMPlexGetPartitioner(weightDM, &partitioner) >> checkError;
+    PetscPartitionerType partitionerType;
+    PetscPartitionerGetType(partitioner, &partitionerType) >> checkError;
+    PetscBool weightedPartitioner = PETSC_FALSE;
+    for (const auto& type : {PETSCPARTITIONERPARMETIS, PETSCPARTITIONERPTSCOTCH}) {
+        PetscBool match;
+        PetscStrcmp(partitionerType, type, &match) >> checkError;
+        weightedPartitioner = (PetscBool)(weightedPartitioner || match);
+    }
+    if (!weightedPartitioner) {
+        PetscInfo2(NULL, "Flow %s is repartitioned with the %s partitioner, which ignores the cell weights\n", GetName().c_str(), partitionerType) >> checkError;
+    }
+
+    // compute the new partition
+    DM newBaseDM = nullptr;
+    PetscSF migrationSF = nullptr;
+    DMSetBasicAdjacency(weightDM, PETSC_TRUE, PETSC_FALSE) >> checkError;
+    DMPlexDistribute(weightDM, ghostCellDepth, &migrationSF, &newBaseDM) >> checkError;
+    DMDestroy(&weightDM) >> checkError;
+    if (!newBaseDM) {
+        return;
+    }
+
+    // distribute the flow and aux values using the current local vectors
+    PetscSection newFlowSection, newAuxSection = nullptr;
+    Vec newFlowValues, newAuxValues = nullptr;
+    {
+        Vec locFlowField;
+        DMGetLocalVector(dm, &locFlowField) >> checkError;
+        DMGlobalToLocal(dm, flowField, INSERT_VALUES, locFlowField) >> checkError;
+        DistributeCellField(dm, locFlowField, cStart, cEnd, baseDM, migrationSF, &newFlowSection, &newFlowValues);
+        DMRestoreLocalVector(dm, &locFlowField) >> checkError;
+    }
+    if (auxDM) {
+        DistributeCellField(auxDM, auxField, cStart, cEnd, baseDM, migrationSF, &newAuxSection, &newAuxValues);
+    }
+    PetscSFDestroy(&migrationSF) >> checkError;
+
+    // create the new dm with ghost cells
+    DM newDM;
+    DMPlexConstructGhostCells(newBaseDM, NULL, NULL, &newDM) >> checkError;
+    DMSetBasicAdjacency(newDM, PETSC_TRUE, PETSC_FALSE) >> checkError;
+    DMCopyDisc(dm, newDM) >> checkError;
+    DMSetApplicationContext(newDM, this) >> checkError;
+    {
+        const char* dmName;
+        PetscObjectGetName((PetscObject)dm, &dmName) >> checkError;
+        PetscObjectSetName((PetscObject)newDM, dmName) >> checkError;
+    }
+    DMPlexCreateClosureIndex(newDM, NULL) >> checkError;
+
+    // copy over the flow field
+    Vec newFlowField;
+    DMCreateGlobalVector(newDM, &newFlowField) >> checkError;
+    PetscObjectSetName((PetscObject)newFlowField, "flowField") >> checkError;
+    CopyDistributedCellField(newFlowSection, newFlowValues, newDM, newFlowField, PETSC_TRUE);
+    PetscSectionDestroy(&newFlowSection) >> checkError;
+    VecDestroy(&newFlowValues) >> checkError;
+
+    // recreate the aux dm and field
+    if (auxDM) {
+        DM newAuxDM;
+        DM coordDM;
+        DMGetCoordinateDM(newDM, &coordDM) >> checkError;
+        DMClone(newDM, &newAuxDM) >> checkError;
+        PetscObjectCompose((PetscObject)newDM, "dmAux", (PetscObject)newAuxDM) >> checkError;
+        DMSetCoordinateDM(newAuxDM, coordDM) >> checkError;
+        DMCopyDisc(auxDM, newAuxDM) >> checkError;
+
+        Vec newAuxField;
+        DMCreateLocalVector(newAuxDM, &newAuxField) >> checkError;
+        PetscObjectCompose((PetscObject)newDM, "A", (PetscObject)newAuxField) >> checkError;
+        PetscObjectSetName((PetscObject)newAuxField, "auxField") >> checkError;
+        CopyDistributedCellField(newAuxSection, newAuxValues, newAuxDM, newAuxField, PETSC_FALSE);
+        PetscSectionDestroy(&newAuxSection) >> checkError;
+        VecDestroy(&newAuxValues) >> checkError;
+
+        VecDestroy(&auxField) >> checkError;
+        DMDestroy(&auxDM) >> checkError;
+        auxField = newAuxField;
+        auxDM = newAuxDM;
+    }
+
+    // reset the ts so that the work vectors are recreated with the new layout
+    TSReset(ts) >> checkError;
+    TSSetDM(ts, newDM) >> checkError;
+    DMTSSetRHSFunctionLocal(newDM, FVRHSFunctionLocal, this) >> checkError;
+    TSSetSolution(ts, newFlowField) >> checkError;
+
+    // swap out the flow field and dms
+    if (initialFlowField) {
+        VecDestroy(&flowField) >> checkError;
+    } else {
+        initialFlowField = flowField;
+    }
+    flowField = newFlowField;
+    DMDestroy(&dm) >> checkError;
+    dm = newDM;
+    DMDestroy(&baseDM) >> checkError;
+    baseDM = newBaseDM;
+
+    // the boundary conditions are copied with the ds, but any values they hold for the old dm must be updated
+    for (const auto& boundary : boundaryConditions) {
+        boundary->UpdateDomain(dm);
+    }
+
+    // the implicit function and jacobian are attached to the old dm
+    if (HasImplicitFunctions()) {
+        SetupImplicitSolve(ts);
+    }
+}
 
 #include "parser/registrar.hpp"
 REGISTER(ablate::flow::Flow, ablate::flow::FVFlow, "finite volume flow", ARG(std::string, "name", "the name of the flow field"), ARG(ablate::mesh::Mesh, "mesh", "the  mesh and discretization"),
@@ -3,7 +3,9 @@
 
 #include <fvSupport.h>
 #include <eos/eos.hpp>
+#include <memory>
 #include <string>
+#include <utilities/reductionAggregator.hpp>
 #include <vector>
 #include "flow.hpp"
 
@@ -18,6 +20,8 @@ class FVFlow : public Flow {
    public:
     using RHSArbitraryFunction = PetscErrorCode (*)(DM dm, PetscReal time, Vec locXVec, Vec globFVec, void* ctx);
     using ComputeTimeStepFunction = double (*)(TS ts, Flow&, void* ctx);
+    using ComputeCellWeightFunction = PetscReal (*)(Flow&, PetscInt cell, void* ctx);
+    using ComputeLocalTimeStepFunction = void (*)(TS ts, Flow&, PetscInt cStart, PetscInt cEnd, PetscReal* cellDt, void* ctx);
 
    private:
     // hold the update functions for flux and point sources
@@ -28,15 +32,122 @@ class FVFlow : public Flow {
     // allow the use of any arbitrary rhs functions
     std::vector<std::pair<RHSArbitraryFunction, void*>> rhsArbitraryFunctions;
 
+    // functions registered by implicit processes.  These are evaluated in the ts IFunction so they can be integrated implicitly or IMEX
+    std::vector<FVMRHSFluxFunctionDescription> implicitRhsFluxFunctionDescriptions;
+    std::vector<FVMRHSPointFunctionDescription> implicitRhsPointFunctionDescriptions;
+    std::vector<std::pair<RHSArbitraryFunction, void*>> implicitRhsArbitraryFunctions;
+
+    // set while an implicit process is initialized so that its functions are added to the implicit lists
+    bool registerImplicit = false;
+
     // functions to update the timestep
     std::vector<std::pair<ComputeTimeStepFunction, void*>> timeStepFunctions;
 
+    // functions to compute the time step in each cell, used for local time stepping
+    std::vector<std::pair<ComputeLocalTimeStepFunction, void*>> localTimeStepFunctions;
+
+    // when local time stepping, the rhs in each cell (starting at localTimeStepCellStart) is scaled by the ratio of the local to global dt
+    PetscInt localTimeStepCellStart = 0;
+    std::vector<PetscReal> localTimeStepScale;
+
+    // functions to estimate the relative cost of each cell, used when repartitioning
+    std::vector<std::pair<ComputeCellWeightFunction, void*>> cellWeightFunctions;
+
     // Hold the flow processes.  This is mostly just to hold a pointer to them
     std::vector<std::shared_ptr<processes::FlowProcess>> flowProcesses;
 
+    // the distributed dm before the ghost cells are added.  This is used to repartition the mesh
+    DM baseDM;
+
+    // the flowField returned before the first repartition is the vector passed to TSSolve, which keeps using it until the solve returns.  It is held
+    // here (instead of destroyed with each repartition) and destroyed with the flow, see Flow::GetSolutionVector
+    Vec initialFlowField;
+
+    // how often to check for repartitioning (0 disables) and the imbalance (max/mean cell weight per rank) required to repartition
+    const PetscInt repartitionInterval;
+    const PetscReal repartitionImbalance;
+
+    // the cell weights are multiplied by this resolution and rounded, because the partitioner only accepts integer weights
+    static constexpr PetscReal cellWeightResolution = 100.0;
+
+    // fuses the global reductions needed before each step (time step, load imbalance) into a single non-blocking reduction
+    std::unique_ptr<utilities::ReductionAggregator> stepReduction;
+    std::size_t timeStepReductionIndex = 0;
+    std::size_t maxWeightReductionIndex = 0;
+    std::size_t totalWeightReductionIndex = 0;
+
+    // the step number the started reductions were computed for and if they are started at the end of each post step
+    PetscInt stepReductionStep = -1;
+    bool stepReductionPostStep = false;
+
+    // the cell weights computed at the start of a step that is checked for repartitioning
+    PetscInt repartitionCellStart = 0;
+    std::vector<PetscReal> repartitionCellWeights;
+
+    // log events for the rhs evaluation and boundary insertion
+    PetscLogEvent rhsLogEvent;
+    PetscLogEvent boundaryLogEvent;
+    PetscLogEvent implicitLogEvent;
+
+    /**
+     * Function passed into PETSc to compute the implicit part of the FV system, F(t, U, Udot) = Udot - G_implicit(t, U)
+     * @param ts
+     * @param time
+     * @param U
+     * @param Udot
+     * @param F
+     * @param ctx
+     * @return
+     */
+    static PetscErrorCode FVIFunction(TS ts, PetscReal time, Vec U, Vec Udot, Vec F, void* ctx);
+
+    /**
+     * Sets the IFunction, a matrix free Jacobian, and a colored finite difference preconditioner from the face neighbor stencil on the current dm.
+     * This must be called again any time the dm changes.
+     * @param ts
+     */
+    void SetupImplicitSolve(TS ts);
+
+    bool HasImplicitFunctions() const { return !implicitRhsFluxFunctionDescriptions.empty() || !implicitRhsPointFunctionDescriptions.empty() || !implicitRhsArbitraryFunctions.empty(); }
+
+    // static function to compute the local contributions to the step reductions and start the fused reduction
+    static void StartStepReductions(TS, Flow&);
+
+    // static function to start the step reductions if they were not started at the end of the previous step
+    static void PrepareStepReductions(TS, Flow&);
+
     // static function to update the flowfield
     static void ComputeTimeStep(TS, Flow&);
 
+    // static function to compute the local time step scaling for each cell
+    static void ComputeLocalTimeStep(TS, Flow&);
+
+    // static function to repartition the flow if needed
+    static void Repartition(TS, Flow&);
+
+    /**
+     * Determines if this step should be checked for repartitioning
+     * @param ts
+     * @return
+     */
+    bool IsRepartitionStep(TS ts) const;
+
+    /**
+     * Computes the weight of each owned interior cell in [cStart, cEnd).  Ghost and non owned cells are assigned zero weight.
+     * @param cStart
+     * @param cEnd
+     * @return
+     */
+    std::vector<PetscReal> ComputeCellWeights(PetscInt& cStart, PetscInt& cEnd) const;
+
+    /**
+     * Redistributes the base mesh using the cell weights, rebuilds the ghost cells, and migrates the flow/aux fields to the new dm
+     * @param ts
+     * @param cStart
+     * @param cellWeights
+     */
+    void RedistributeMesh(TS ts, PetscInt cStart, const std::vector<PetscReal>& cellWeights);
+
    public:
     FVFlow(std::string name, std::shared_ptr<mesh::Mesh> mesh, std::shared_ptr<parameters::Parameters> parameters, std::vector<FlowFieldDescriptor> fieldDescriptors,
            std::vector<std::shared_ptr<processes::FlowProcess>> flowProcesses, std::shared_ptr<parameters::Parameters> options,
@@ -47,10 +158,19 @@ class FVFlow : public Flow {
            std::vector<std::shared_ptr<mathFunctions::FieldFunction>> initialization, std::vector<std::shared_ptr<boundaryConditions::BoundaryCondition>> boundaryConditions,
            std::vector<std::shared_ptr<mathFunctions::FieldFunction>> auxiliaryFields, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolution);
 
-    ~FVFlow() override = default;
+    ~FVFlow() override;
 
     void CompleteProblemSetup(TS ts) override;
 
+    /**
+     * Computes the rhs without the local time step scaling
+     * @param ts
+     * @param time
+     * @param u
+     * @param rhs
+     */
+    void ComputeRHSFunction(TS ts, PetscReal time, Vec u, Vec rhs) override;
+
     /**
      * Function passed into PETSc to compute the FV RHS
      * @param dm
@@ -62,6 +182,13 @@ class FVFlow : public Flow {
      */
     static PetscErrorCode FVRHSFunctionLocal(DM dm, PetscReal time, Vec locXVec, Vec globFVec, void* ctx);
 
+    /**
+     * Initializes the process so that any rhs functions it registers are integrated implicitly (through the ts IFunction).  Time step
+     * functions registered by the process are ignored because the implicit terms do not limit the stable time step.
+     * @param process
+     */
+    void InitializeImplicitProcess(processes::FlowProcess& process);
+
     /**
      * Register a FVM rhs source flux function
      * @param function
@@ -108,6 +235,20 @@ class FVFlow : public Flow {
      * @param auxFields
      */
     void RegisterComputeTimeStepFunction(ComputeTimeStepFunction function, void* ctx);
+
+    /**
+     * Register a function to compute the stable time step in each cell.  These are only used when the ts option -ts_local_time_stepping is set.
+     * @param function
+     * @param ctx
+     */
+    void RegisterComputeLocalTimeStepFunction(ComputeLocalTimeStepFunction function, void* ctx);
+
+    /**
+     * Register a function to estimate the additional cost of each cell.  Each cell has a base weight of one.
+     * @param function
+     * @param ctx
+     */
+    void RegisterComputeCellWeightFunction(ComputeCellWeightFunction function, void* ctx);
 };
 
 }  // namespace ablate::flow
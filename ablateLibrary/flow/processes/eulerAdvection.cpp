@@ -216,7 +216,68 @@ void ablate::flow::processes::EulerAdvection::Initialize(ablate::flow::FVFlow& f
     PetscOptionsGetBool(NULL, NULL, "-automaticTimeStepCalculator", &automaticTimeStepCalculator, NULL);
     if (automaticTimeStepCalculator) {
         flow.RegisterComputeTimeStepFunction(ComputeTimeStep, eulerAdvectionData);
+        flow.RegisterComputeLocalTimeStepFunction(ComputeLocalTimeStep, this);
+
+        // the cell geometry changes when the flow is repartitioned, so the cached radius is rebuilt on the next local time step
+        flow.RegisterPostRepartition([this](TS, ablate::flow::Flow&) { cellRadius.clear(); });
+    }
+}
+
+void ablate::flow::processes::EulerAdvection::ComputeCellRadius(DM dm, PetscInt cStart, PetscInt cEnd) {
+    // Get the fv geom
+    Vec faceGeomVec, cellGeomVec;
+    DM dmFace, dmCell;
+    DMPlexGetGeometryFVM(dm, &faceGeomVec, &cellGeomVec, NULL) >> checkError;
+    VecGetDM(faceGeomVec, &dmFace) >> checkError;
+    VecGetDM(cellGeomVec, &dmCell) >> checkError;
+    const PetscScalar* faceGeomArray;
+    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+    const PetscScalar* cellGeomArray;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+
+    PetscInt dim;
+    DMGetDimension(dm, &dim) >> checkError;
+
+    // the cell radius is the smallest centroid to face distance, the same measure the global minCellRadius is built from
+    cellRadiusStart = cStart;
+    cellRadius.assign(cEnd - cStart, PETSC_MAX_REAL);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscFVCellGeom* cellGeom;
+        DMPlexPointLocalRead(dmCell, c, cellGeomArray, &cellGeom) >> checkError;
+
+        const PetscInt* faces;
+        PetscInt numberFaces;
+        DMPlexGetConeSize(dm, c, &numberFaces) >> checkError;
+        DMPlexGetCone(dm, c, &faces) >> checkError;
+        for (PetscInt f = 0; f < numberFaces; f++) {
+            PetscFVFaceGeom* faceGeom;
+            DMPlexPointLocalRead(dmFace, faces[f], faceGeomArray, &faceGeom) >> checkError;
+            PetscReal distance = 0.0;
+            for (PetscInt d = 0; d < dim; d++) {
+                distance += PetscSqr(faceGeom->centroid[d] - cellGeom->centroid[d]);
+            }
+            cellRadius[c - cStart] = PetscMin(cellRadius[c - cStart], PetscSqrtReal(distance));
+        }
     }
+    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+    VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+}
+
+PetscReal ablate::flow::processes::EulerAdvection::ComputeCellTimeStep(EulerAdvectionData eulerAdvectionData, PetscInt dim, const PetscReal* xc, const PetscReal* densityYi, PetscReal dx) {
+    PetscReal rho = xc[RHO];
+    PetscReal vel[3];
+    for (PetscInt i = 0; i < dim; i++) {
+        vel[i] = xc[RHOU + i] / rho;
+    }
+
+    // Get the speed of sound from the eos
+    PetscReal ie;
+    PetscReal a;
+    PetscReal p;
+    eulerAdvectionData->decodeStateFunction(dim, rho, xc[RHOE] / rho, vel, densityYi, &ie, &a, &p, eulerAdvectionData->decodeStateFunctionContext) >> checkError;
+
+    PetscReal u = xc[RHOU] / rho;
+    return eulerAdvectionData->cfl * dx / (a + PetscAbsReal(u));
 }
 
 double ablate::flow::processes::EulerAdvection::ComputeTimeStep(TS ts, ablate::flow::Flow& flow, void* ctx) {
@@ -260,28 +321,60 @@ double ablate::flow::processes::EulerAdvection::ComputeTimeStep(TS ts, ablate::f
         }
 
         if (xc) {  // must be real cell and not ghost
-            PetscReal rho = xc[RHO];
-            PetscReal vel[3];
-            for (PetscInt i = 0; i < dim; i++) {
-                vel[i] = xc[RHOU + i] / rho;
-            }
+            dtMin = PetscMin(dtMin, ComputeCellTimeStep(eulerAdvectionData, dim, xc, densityYi, dx));
+        }
+    }
+    VecRestoreArrayRead(v, &x) >> checkError;
+    return dtMin;
+}
+
+void ablate::flow::processes::EulerAdvection::ComputeLocalTimeStep(TS ts, ablate::flow::Flow& flow, PetscInt cStart, PetscInt cEnd, PetscReal* cellDt, void* ctx) {
+    // Get the dm and current solution vector
+    DM dm;
+    TSGetDM(ts, &dm) >> checkError;
+    Vec v;
+    TSGetSolution(ts, &v) >> checkError;
+
+    // Get the euler advection process and its flow param
+    auto eulerAdvection = (ablate::flow::processes::EulerAdvection*)ctx;
+    EulerAdvectionData eulerAdvectionData = eulerAdvection->eulerAdvectionData;
+
+    // the cell radius only depends upon the mesh, so it is only computed the first time or after the cell range changes
+    if (eulerAdvection->cellRadius.empty() || eulerAdvection->cellRadiusStart != cStart || (PetscInt)eulerAdvection->cellRadius.size() != cEnd - cStart) {
+        eulerAdvection->ComputeCellRadius(dm, cStart, cEnd);
+    }
+
+    const PetscScalar* x;
+    VecGetArrayRead(v, &x) >> checkError;
 
-            // Get the speed of sound from the eos
-            PetscReal ie;
-            PetscReal a;
-            PetscReal p;
-            eulerAdvectionData->decodeStateFunction(dim, rho, xc[RHOE] / rho, vel, densityYi, &ie, &a, &p, eulerAdvectionData->decodeStateFunctionContext) >> checkError;
+    // Get the dim from the dm
+    PetscInt dim;
+    DMGetDimension(dm, &dim) >> checkError;
 
-            PetscReal u = xc[RHOU] / rho;
-            PetscReal dt = eulerAdvectionData->cfl * dx / (a + PetscAbsReal(u));
-            dtMin = PetscMin(dtMin, dt);
+    // Get field location for euler and densityYi
+    auto eulerId = flow.GetFieldId("euler").value();
+    auto densityYiId = flow.GetFieldId("densityYi").value_or(-1);
+
+    // March over each cell
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        const PetscReal* xc;
+        const PetscReal* densityYi = NULL;
+        DMPlexPointGlobalFieldRead(dm, c, eulerId, x, &xc) >> checkError;
+
+        if (densityYiId >= 0) {
+            DMPlexPointGlobalFieldRead(dm, c, densityYiId, x, &densityYi) >> checkError;
+        }
+
+        if (xc) {  // must be real cell and not ghost
+            // use the same length scale as the global time step so the limiting cell gets the global dt
+            cellDt[c - cStart] = PetscMin(cellDt[c - cStart], ComputeCellTimeStep(eulerAdvectionData, dim, xc, densityYi, 2.0 * eulerAdvection->cellRadius[c - cStart]));
         }
     }
     VecRestoreArrayRead(v, &x) >> checkError;
-    return dtMin;
 }
 
 #include "parser/registrar.hpp"
-REGISTER(ablate::flow::processes::FlowProcess, ablate::flow::processes::EulerAdvection, "build advection for the euler field and species",
+REGISTER(ablate::flow::processes::FlowProcess, ablate::flow::processes::EulerAdvection,
+         "build advection for the euler field and species. The automaticTimeStepCalculator (on by default) provides the global and per cell time steps, so it is required for ts_local_time_stepping",
          OPT(ablate::parameters::Parameters, "parameters", "the parameters used by advection"), ARG(ablate::eos::EOS, "eos", "the equation of state used to describe the flow"),
          OPT(ablate::flow::fluxCalculator::FluxCalculator, "fluxCalculator", "the flux calculator (defaults to AUSM)"));
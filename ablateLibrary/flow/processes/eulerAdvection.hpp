@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_EULERADVECTION_HPP
 
 #include <petsc.h>
+#include <vector>
 #include "flow/fluxCalculator/fluxCalculator.hpp"
 #include "flowProcess.hpp"
 
@@ -68,9 +69,22 @@ class EulerAdvection : public FlowProcess {
     std::shared_ptr<eos::EOS> eos;
     std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculator;
 
+    // the smallest centroid to face distance for each cell starting at cellRadiusStart, cleared when the flow is repartitioned
+    PetscInt cellRadiusStart = 0;
+    std::vector<PetscReal> cellRadius;
+
+    // rebuild the cell radius cache over [cStart, cEnd) from the dm fv geometry
+    void ComputeCellRadius(DM dm, PetscInt cStart, PetscInt cEnd);
+
+    // the stable time step for a single cell with length dx, shared by the global and local time step calculations
+    static PetscReal ComputeCellTimeStep(EulerAdvectionData eulerAdvectionData, PetscInt dim, const PetscReal* xc, const PetscReal* densityYi, PetscReal dx);
+
     // static function to compute time step for euler advection
     static double ComputeTimeStep(TS ts, ablate::flow::Flow& flow, void* ctx);
 
+    // static function to compute the stable time step in each cell based upon the cell size
+    static void ComputeLocalTimeStep(TS ts, ablate::flow::Flow& flow, PetscInt cStart, PetscInt cEnd, PetscReal* cellDt, void* ctx);
+
     /**
      * Private function to decode the euler fields
      * @param flowData
@@ -0,0 +1,9 @@
+#include "implicitProcess.hpp"
+
+ablate::flow::processes::ImplicitProcess::ImplicitProcess(std::shared_ptr<FlowProcess> process) : process(process) {}
+
+void ablate::flow::processes::ImplicitProcess::Initialize(ablate::flow::FVFlow& flow) { flow.InitializeImplicitProcess(*process); }
+
+#include "parser/registrar.hpp"
+REGISTER(ablate::flow::processes::FlowProcess, ablate::flow::processes::ImplicitProcess, "integrates the provided process implicitly using the ts IFunction. The Jacobian is matrix free (-snes_mf_operator) with a face neighbor finite difference preconditioner",
+         ARG(ablate::flow::processes::FlowProcess, "process", "the process to be treated implicitly"));
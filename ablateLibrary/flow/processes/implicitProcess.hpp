@@ -0,0 +1,33 @@
+#ifndef ABLATELIBRARY_IMPLICITPROCESS_HPP
+#define ABLATELIBRARY_IMPLICITPROCESS_HPP
+
+#include <memory>
+#include "flowProcess.hpp"
+
+namespace ablate::flow::processes {
+
+/**
+ * Wraps another process so that the rhs terms it registers are integrated implicitly (or IMEX when other processes remain explicit).  This requires
+ * an implicit or IMEX ts_type such as beuler, bdf, or arkimex.  The Jacobian is applied matrix free (-snes_mf_operator) and preconditioned with a
+ * finite difference Jacobian over the face neighbors only, so the preconditioner weakens as the gradient stencil grows.
+ */
+class ImplicitProcess : public FlowProcess {
+   private:
+    const std::shared_ptr<FlowProcess> process;
+
+   public:
+    explicit ImplicitProcess(std::shared_ptr<FlowProcess> process);
+
+    void Initialize(ablate::flow::FVFlow& flow) override;
+
+    /**
+     * Helper function to optionally wrap a process in an ImplicitProcess
+     * @param process
+     * @param implicit
+     * @return
+     */
+    static std::shared_ptr<FlowProcess> Wrap(std::shared_ptr<FlowProcess> process, bool implicit) { return implicit ? std::make_shared<ImplicitProcess>(process) : process; }
+};
+
+}  // namespace ablate::flow::processes
+#endif  // ABLATELIBRARY_IMPLICITPROCESS_HPP
@@ -104,6 +104,26 @@ ablate::flow::processes::TChemReactions::~TChemReactions() {
 }
 
 void ablate::flow::processes::TChemReactions::Initialize(ablate::flow::FVFlow& flow) {
+    CreateSourceField(flow);
+
+    // Before each step, compute the source term over the entire dt
+    auto chemistryPreStage = std::bind(&ablate::flow::processes::TChemReactions::ChemistryFlowPreStage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+    flow.RegisterPreStage(chemistryPreStage);
+
+    // Add the rhs point function for the source
+    flow.RegisterRHSFunction(AddChemistrySourceToFlow, this);
+
+    // weight each cell by the chemistry cost and rebuild the source field if the flow is repartitioned
+    flow.RegisterComputeCellWeightFunction(ComputeChemistryCellWeight, this);
+    flow.RegisterPostRepartition([this](TS, ablate::flow::Flow& flow) {
+        DMDestroy(&fieldDm) >> checkError;
+        VecDestroy(&sourceVec) >> checkError;
+        cellChemistrySteps.clear();
+        CreateSourceField(flow);
+    });
+}
+
+void ablate::flow::processes::TChemReactions::CreateSourceField(ablate::flow::Flow& flow) {
     // Create a copy of the dm for the solver
     DM coordDM;
     DMGetCoordinateDM(flow.GetDM(), &coordDM) >> checkError;
@@ -123,13 +143,14 @@ void ablate::flow::processes::TChemReactions::Initialize(ablate::flow::FVFlow& f
 
     // create a vector to hold the source terms
     DMCreateLocalVector(fieldDm, &sourceVec) >> checkError;
+}
 
-    // Before each step, compute the source term over the entire dt
-    auto chemistryPreStage = std::bind(&ablate::flow::processes::TChemReactions::ChemistryFlowPreStage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-    flow.RegisterPreStage(chemistryPreStage);
-
-    // Add the rhs point function for the source
-    flow.RegisterRHSFunction(AddChemistrySourceToFlow, this);
+PetscReal ablate::flow::processes::TChemReactions::ComputeChemistryCellWeight(ablate::flow::Flow&, PetscInt cell, void* ctx) {
+    auto tChemReactions = (TChemReactions*)ctx;
+    if (cell < (PetscInt)tChemReactions->cellChemistrySteps.size()) {
+        return (PetscReal)tChemReactions->cellChemistrySteps[cell];
+    }
+    return 0.0;
 }
 
 PetscErrorCode ablate::flow::processes::TChemReactions::SinglePointChemistryRHS(TS ts, PetscReal t, Vec X, Vec F, void* ptr) {
@@ -268,6 +289,12 @@ PetscErrorCode ablate::flow::processes::TChemReactions::ChemistryFlowPreStage(TS
     //    eos::ComputeSensibleInternalEnergyFunction sensibleInternalEnergyFunction = eos->GetComputeSensibleInternalEnergyFunction();
     //    void* sensibleInternalEnergyContext = eos->GetComputeSensibleInternalEnergyContext();
 
+    // size the chemistry cost for every cell in the dm
+    PetscInt cellEnd;
+    ierr = DMPlexGetHeightStratum(flow.GetDM(), 0, NULL, &cellEnd);
+    CHKERRQ(ierr);
+    cellChemistrySteps.resize(cellEnd, 0);
+
     // March over each cell
     for (PetscInt c = cStart; c < cEnd; ++c) {
         // if there is a cell array, use it, otherwise it is just c
@@ -335,6 +362,12 @@ PetscErrorCode ablate::flow::processes::TChemReactions::ChemistryFlowPreStage(TS
             // solver for this point
             ierr = TSSolve(ts, pointData);
 
+            // record the cost of this cell, keeping the solve error code to check below
+            PetscInt chemistrySteps;
+            PetscErrorCode stepIerr = TSGetStepNumber(ts, &chemistrySteps);
+            CHKERRQ(stepIerr);
+            cellChemistrySteps[cell] = chemistrySteps;
+
             if (ierr != 0) {
                 std::string error = "Could not solve chemistry ode, setting source terms to zero T,P (" + std::to_string(temperature) + ", " + std::to_string(pressure) + ") \n (euler, yi): ";
                 for (PetscInt i = 0; i < dim + 2; i++) {
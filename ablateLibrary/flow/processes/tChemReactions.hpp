@@ -33,6 +33,24 @@ class TChemReactions : public FlowProcess {
     /* Keep track of the chemistry ts time */
     PetscLogStage chemSolveStage;
 
+    /* The number of chemistry steps taken by each cell during the last solve. This is used as a cell weight for repartitioning */
+    std::vector<PetscInt> cellChemistrySteps;
+
+    /**
+     * Create the dm and vector used to store the chemistry source terms
+     * @param flow
+     */
+    void CreateSourceField(ablate::flow::Flow &flow);
+
+    /**
+     * The relative cost of each cell is based upon the number of chemistry steps
+     * @param flow
+     * @param cell
+     * @param ctx
+     * @return
+     */
+    static PetscReal ComputeChemistryCellWeight(ablate::flow::Flow &flow, PetscInt cell, void *ctx);
+
     /**
      * Private function to integrate single point chemistry in time
      * @param ts
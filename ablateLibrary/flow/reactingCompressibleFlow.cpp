@@ -1,6 +1,7 @@
 #include "reactingCompressibleFlow.hpp"
 #include <flow/processes/eulerAdvection.hpp>
 #include <flow/processes/eulerDiffusion.hpp>
+#include <flow/processes/implicitProcess.hpp>
 #include <flow/processes/speciesDiffusion.hpp>
 #include <flow/processes/tChemReactions.hpp>
 #include <utilities/mpiError.hpp>
@@ -26,8 +27,11 @@ ablate::flow::ReactingCompressibleFlow::ReactingCompressibleFlow(std::string nam
              {
                  // create assumed processes for compressible flow
                  std::make_shared<ablate::flow::processes::EulerAdvection>(parameters, eosIn, fluxCalculatorIn),
-                 std::make_shared<ablate::flow::processes::EulerDiffusion>(eosIn, transport),
-                 std::make_shared<ablate::flow::processes::SpeciesDiffusion>(eosIn, transport),
+                 // the diffusion processes can optionally be integrated implicitly
+                 ablate::flow::processes::ImplicitProcess::Wrap(std::make_shared<ablate::flow::processes::EulerDiffusion>(eosIn, transport),
+                                                                parameters && parameters->Get<bool>("implicitDiffusion", false)),
+                 ablate::flow::processes::ImplicitProcess::Wrap(std::make_shared<ablate::flow::processes::SpeciesDiffusion>(eosIn, transport),
+                                                                parameters && parameters->Get<bool>("implicitDiffusion", false)),
                  std::make_shared<ablate::flow::processes::TChemReactions>(std::dynamic_pointer_cast<eos::TChem>(eosIn) ? std::dynamic_pointer_cast<eos::TChem>(eosIn)
                                                                                                                         : throw std::invalid_argument("The eos must of type eos::TChem")),
              },
@@ -36,7 +40,7 @@ ablate::flow::ReactingCompressibleFlow::ReactingCompressibleFlow(std::string nam
 #include "parser/registrar.hpp"
 REGISTER(ablate::flow::Flow, ablate::flow::ReactingCompressibleFlow, "reacting compressible finite volume flow", ARG(std::string, "name", "the name of the flow field"),
          ARG(ablate::mesh::Mesh, "mesh", "the  mesh and discretization"), ARG(ablate::eos::EOS, "eos", "the TChem v1 equation of state used to describe the flow"),
-         ARG(ablate::parameters::Parameters, "parameters", "the compressible flow parameters cfl, gamma, etc."),
+         ARG(ablate::parameters::Parameters, "parameters", "the compressible flow parameters cfl, gamma, implicitDiffusion, etc."),
          OPT(ablate::eos::transport::TransportModel, "transport", "the diffusion transport model"),
          OPT(ablate::flow::fluxCalculator::FluxCalculator, "fluxCalculator", "the flux calculator (defaults to AUSM)"), OPT(ablate::parameters::Parameters, "options", "the options passed to PETSc"),
          OPT(std::vector<mathFunctions::FieldFunction>, "initialization", "the flow field initialization"),
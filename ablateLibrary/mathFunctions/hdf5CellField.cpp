@@ -0,0 +1,169 @@
+#include "hdf5CellField.hpp"
+#include <petscviewerhdf5.h>
+#include "utilities/petscError.hpp"
+
+ablate::mathFunctions::Hdf5CellField::Hdf5CellField(std::filesystem::path file, std::string fieldName, int fromLast) {
+    if (!std::filesystem::exists(file)) {
+        throw std::invalid_argument("Cannot locate hdf5 file " + file.string());
+    }
+
+    // each rank holds a serial copy of the saved solution
+    PetscViewer viewer;
+    PetscViewerHDF5Open(PETSC_COMM_SELF, file.string().c_str(), FILE_MODE_READ, &viewer) >> checkError;
+
+    // load the vertices and cell connectivity used for visualization.  These do not include ghost cells and are in the same order as the cell fields
+    Vec vertices;
+    VecCreate(PETSC_COMM_SELF, &vertices) >> checkError;
+    PetscObjectSetName((PetscObject)vertices, "vertices") >> checkError;
+    PetscViewerHDF5PushGroup(viewer, "/geometry") >> checkError;
+    VecLoad(vertices, viewer) >> checkError;
+    PetscViewerHDF5PopGroup(viewer) >> checkError;
+
+    IS cells;
+    ISCreate(PETSC_COMM_SELF, &cells) >> checkError;
+    PetscObjectSetName((PetscObject)cells, "cells") >> checkError;
+    PetscViewerHDF5PushGroup(viewer, "/viz/topology") >> checkError;
+    ISLoad(cells, viewer) >> checkError;
+    PetscViewerHDF5PopGroup(viewer) >> checkError;
+
+    // size up the mesh
+    PetscInt dim, numberVertices, numberCorners, numberCells;
+    VecGetBlockSize(vertices, &dim) >> checkError;
+    VecGetLocalSize(vertices, &numberVertices) >> checkError;
+    numberVertices /= dim;
+    ISGetBlockSize(cells, &numberCorners) >> checkError;
+    ISGetLocalSize(cells, &numberCells) >> checkError;
+    numberCells /= numberCorners;
+
+    // rebuild the mesh so that points can be located
+    {
+        const PetscScalar* vertexArray;
+        const PetscInt* cellArray;
+        VecGetArrayRead(vertices, &vertexArray) >> checkError;
+        ISGetIndices(cells, &cellArray) >> checkError;
+        std::vector<PetscReal> vertexCoordinates(vertexArray, vertexArray + numberVertices * dim);
+        DMPlexCreateFromCellListPetsc(PETSC_COMM_SELF, dim, numberCells, numberVertices, numberCorners, PETSC_TRUE, cellArray, dim, &vertexCoordinates[0], &cellDM) >> checkError;
+        ISRestoreIndices(cells, &cellArray) >> checkError;
+        VecRestoreArrayRead(vertices, &vertexArray) >> checkError;
+    }
+    ISDestroy(&cells) >> checkError;
+    VecDestroy(&vertices) >> checkError;
+
+    // locate points with a grid hash of the saved mesh.  It is built with the first location and reused by the dm, so each point only checks nearby cells.
+    PetscOptionsCreate(&locationOptions) >> checkError;
+    PetscOptionsSetValue(locationOptions, "-dm_plex_hash_location", "true") >> checkError;
+    PetscObjectSetOptions((PetscObject)cellDM, locationOptions) >> checkError;
+    VecCreateSeq(PETSC_COMM_SELF, dim, &locationPoint) >> checkError;
+    VecSetBlockSize(locationPoint, dim) >> checkError;
+
+    // determine which output to load
+    PetscInt numberOutputs;
+    PetscViewerHDF5ReadSizes(viewer, "time", NULL, &numberOutputs) >> checkError;
+    PetscInt outputIndex = numberOutputs - 1 - fromLast;
+    if (fromLast < 0 || outputIndex < 0) {
+        throw std::invalid_argument("Output " + std::to_string(fromLast) + " from the last output is not available in " + file.string());
+    }
+
+    // load the cell field
+    Vec field;
+    VecCreate(PETSC_COMM_SELF, &field) >> checkError;
+    PetscObjectSetName((PetscObject)field, fieldName.c_str()) >> checkError;
+    PetscViewerHDF5PushGroup(viewer, "/cell_fields") >> checkError;
+    PetscViewerHDF5SetTimestep(viewer, outputIndex) >> checkError;
+    VecLoad(field, viewer) >> checkError;
+    PetscViewerHDF5PopGroup(viewer) >> checkError;
+    PetscViewerDestroy(&viewer) >> checkError;
+
+    PetscInt fieldSize;
+    VecGetLocalSize(field, &fieldSize) >> checkError;
+    if (numberCells == 0 || fieldSize % numberCells != 0) {
+        throw std::invalid_argument("The field " + fieldName + " in " + file.string() + " is not a cell field");
+    }
+    numberComponents = fieldSize / numberCells;
+
+    const PetscScalar* fieldArray;
+    VecGetArrayRead(field, &fieldArray) >> checkError;
+    cellValues.assign(fieldArray, fieldArray + fieldSize);
+    VecRestoreArrayRead(field, &fieldArray) >> checkError;
+    VecDestroy(&field) >> checkError;
+}
+
+ablate::mathFunctions::Hdf5CellField::~Hdf5CellField() {
+    if (locationPoint) {
+        VecDestroy(&locationPoint);
+    }
+    if (cellDM) {
+        DMDestroy(&cellDM);
+    }
+    if (locationOptions) {
+        PetscOptionsDestroy(&locationOptions);
+    }
+}
+
+PetscInt ablate::mathFunctions::Hdf5CellField::LocateCell(const double* xyz, const int& ndims) const {
+    PetscInt dim;
+    DMGetCoordinateDim(cellDM, &dim) >> checkError;
+
+    PetscScalar* pointArray;
+    VecGetArray(locationPoint, &pointArray) >> checkError;
+    for (PetscInt d = 0; d < dim; d++) {
+        pointArray[d] = d < ndims ? xyz[d] : 0.0;
+    }
+    VecRestoreArray(locationPoint, &pointArray) >> checkError;
+
+    // use the nearest cell so that points just outside the saved mesh (i.e. from round off) are still found
+    PetscSF cellSF = nullptr;
+    DMLocatePoints(cellDM, locationPoint, DM_POINTLOCATION_NEAREST, &cellSF) >> checkError;
+    PetscInt numberFound;
+    const PetscSFNode* foundCells;
+    PetscSFGetGraph(cellSF, NULL, &numberFound, NULL, &foundCells) >> checkError;
+    PetscInt cell = numberFound > 0 ? foundCells[0].index : DMLOCATEPOINT_POINT_NOT_FOUND;
+
+    PetscSFDestroy(&cellSF) >> checkError;
+
+    if (cell < 0) {
+        throw std::runtime_error("Unable to locate point in the hdf5 cell field");
+    }
+    return cell;
+}
+
+double ablate::mathFunctions::Hdf5CellField::Eval(const double& x, const double& y, const double& z, const double& t) const {
+    const double xyz[3] = {x, y, z};
+    return Eval(xyz, 3, t);
+}
+
+double ablate::mathFunctions::Hdf5CellField::Eval(const double* xyz, const int& ndims, const double&) const { return cellValues[LocateCell(xyz, ndims) * numberComponents]; }
+
+void ablate::mathFunctions::Hdf5CellField::Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const {
+    const double xyz[3] = {x, y, z};
+    Eval(xyz, 3, t, result);
+}
+
+void ablate::mathFunctions::Hdf5CellField::Eval(const double* xyz, const int& ndims, const double&, std::vector<double>& result) const {
+    const auto offset = LocateCell(xyz, ndims) * numberComponents;
+    for (std::size_t c = 0; c < PetscMin(result.size(), (std::size_t)numberComponents); c++) {
+        result[c] = cellValues[offset + c];
+    }
+}
+
+PetscErrorCode ablate::mathFunctions::Hdf5CellField::Hdf5CellFieldPetscFunction(PetscInt dim, PetscReal, const PetscReal* x, PetscInt Nf, PetscScalar* u, void* ctx) {
+    PetscFunctionBeginUser;
+    auto hdf5CellField = (Hdf5CellField*)ctx;
+    if (Nf > hdf5CellField->numberComponents) {
+        SETERRQ2(PETSC_COMM_SELF, PETSC_ERR_ARG_SIZ, "The hdf5 cell field has %D components but %D were requested", hdf5CellField->numberComponents, Nf);
+    }
+    try {
+        const auto offset = hdf5CellField->LocateCell(x, dim) * hdf5CellField->numberComponents;
+        for (PetscInt c = 0; c < Nf; c++) {
+            u[c] = hdf5CellField->cellValues[offset + c];
+        }
+    } catch (std::exception& exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, exception.what());
+    }
+    PetscFunctionReturn(0);
+}
+
+#include "parser/registrar.hpp"
+REGISTER(ablate::mathFunctions::MathFunction, ablate::mathFunctions::Hdf5CellField, "interpolates a cell field saved in an hdf5 file (i.e. from the Hdf5Monitor) onto the new location",
+         ARG(std::filesystem::path, "file", "the hdf5 file"), ARG(std::string, "field", "the name of the saved cell field (i.e. flowField_euler)"),
+         OPT(int, "fromLast", "the output to use counted back from the last output (default is 0, the last output)"));
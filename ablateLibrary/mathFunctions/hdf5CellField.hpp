@@ -0,0 +1,63 @@
+#ifndef ABLATELIBRARY_HDF5CELLFIELD_HPP
+#define ABLATELIBRARY_HDF5CELLFIELD_HPP
+
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "mathFunction.hpp"
+
+namespace ablate::mathFunctions {
+
+/**
+ * Interpolates a cell field saved in an hdf5 file (such as the output from the Hdf5Monitor) onto any location.  The saved mesh is rebuilt from the
+ * visualization topology/geometry and the value of the cell containing (or nearest to) each point is returned.  When the new mesh is a refinement of
+ * the saved mesh this is a conservative prolongation of the cell averages.
+ */
+class Hdf5CellField : public MathFunction {
+   private:
+    // the saved mesh without ghost cells
+    DM cellDM = nullptr;
+
+    // the options used to build the grid hash for point location once with the saved mesh
+    PetscOptions locationOptions = nullptr;
+
+    // a single point vector reused for each location
+    Vec locationPoint = nullptr;
+
+    // the number of components in the field and the values in each cell
+    PetscInt numberComponents = 0;
+    std::vector<PetscReal> cellValues;
+
+    /**
+     * Returns the index of the cell containing xyz in the saved mesh
+     * @param xyz
+     * @param ndims
+     * @return
+     */
+    PetscInt LocateCell(const double* xyz, const int& ndims) const;
+
+    static PetscErrorCode Hdf5CellFieldPetscFunction(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
+
+   public:
+    /**
+     * @param file the hdf5 file to read
+     * @param fieldName the name of the saved cell field (vectorName_fieldName, i.e. flowField_euler)
+     * @param fromLast the saved output to use counted back from the last output (0 is the last output)
+     */
+    Hdf5CellField(std::filesystem::path file, std::string fieldName, int fromLast = 0);
+    ~Hdf5CellField() override;
+
+    double Eval(const double& x, const double& y, const double& z, const double& t) const override;
+
+    double Eval(const double* xyz, const int& ndims, const double& t) const override;
+
+    void Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const override;
+
+    void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
+
+    void* GetContext() override { return this; }
+
+    PetscFunction GetPetscFunction() override { return Hdf5CellFieldPetscFunction; }
+};
+}  // namespace ablate::mathFunctions
+#endif  // ABLATELIBRARY_HDF5CELLFIELD_HPP
@@ -0,0 +1,10 @@
+#include "hdf5FieldFunction.hpp"
+#include "hdf5CellField.hpp"
+
+ablate::mathFunctions::Hdf5FieldFunction::Hdf5FieldFunction(std::string fieldName, std::filesystem::path file, int fromLast)
+    : FieldFunction(fieldName, std::make_shared<Hdf5CellField>(file, "flowField_" + fieldName, fromLast)) {}
+
+#include "parser/registrar.hpp"
+REGISTER(ablate::mathFunctions::FieldFunction, ablate::mathFunctions::Hdf5FieldFunction, "initializes the field from a flow saved in an hdf5 file (i.e. from the Hdf5Monitor)",
+         ARG(std::string, "fieldName", "the field name"), ARG(std::filesystem::path, "file", "the hdf5 file written for the flow"),
+         OPT(int, "fromLast", "the output to use counted back from the last output (default is 0, the last output)"));
@@ -0,0 +1,17 @@
+#ifndef ABLATELIBRARY_HDF5FIELDFUNCTION_HPP
+#define ABLATELIBRARY_HDF5FIELDFUNCTION_HPP
+#include <filesystem>
+#include "fieldFunction.hpp"
+
+namespace ablate::mathFunctions {
+
+/**
+ * Initializes a flow field from the flow saved in an hdf5 file (i.e. from the Hdf5Monitor on a coarser mesh).  This is a shortcut for a FieldFunction
+ * with an Hdf5CellField.
+ */
+class Hdf5FieldFunction : public FieldFunction {
+   public:
+    Hdf5FieldFunction(std::string fieldName, std::filesystem::path file, int fromLast = 0);
+};
+}  // namespace ablate::mathFunctions
+#endif  // ABLATELIBRARY_HDF5FIELDFUNCTION_HPP
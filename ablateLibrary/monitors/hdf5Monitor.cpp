@@ -33,16 +33,25 @@ PetscErrorCode ablate::monitors::Hdf5Monitor::OutputHdf5(TS ts, PetscInt steps,
     auto monitorObject = monitor->viewableObject;
 
     if (steps == 0 || monitor->interval == 0 || (steps % monitor->interval == 0)) {
+        PetscErrorCode ierr = PetscLogEventBegin(monitor->outputLogEvent, 0, 0, 0, 0);
+        CHKERRQ(ierr);
         try {
             monitorObject->View(monitor->petscViewer, monitor->index, time, u);
         } catch (std::exception &e) {
             SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, e.what());
         }
+        ierr = PetscLogEventEnd(monitor->outputLogEvent, 0, 0, 0, 0);
+        CHKERRQ(ierr);
         monitor->index++;
     }
     PetscFunctionReturn(0);
 }
-ablate::monitors::Hdf5Monitor::Hdf5Monitor(int interval) : interval(interval) {}
+ablate::monitors::Hdf5Monitor::Hdf5Monitor(int interval) : interval(interval) {
+    PetscLogEventGetId("Hdf5Output", &outputLogEvent) >> checkError;
+    if (outputLogEvent < 0) {
+        PetscLogEventRegister("Hdf5Output", PETSC_VIEWER_CLASSID, &outputLogEvent) >> checkError;
+    }
+}
 
 #include "parser/registrar.hpp"
 REGISTER(ablate::monitors::Monitor, ablate::monitors::Hdf5Monitor, "writes the viewable object to an hdf5", ARG(int, "interval", "how often to write the HDF5 file (default is every timestep)"));
@@ -6,10 +6,12 @@
 #include "viewable.hpp"
 namespace ablate::monitors {
 class Hdf5Monitor : public Monitor {
-   private:
+   protected:
     PetscInt index = 0;
 
-   protected:
+    // log event for writing the output
+    PetscLogEvent outputLogEvent;
+
     PetscViewer petscViewer = nullptr;
     std::filesystem::path outputFilePath;
     const std::string extension = ".hdf5";
@@ -0,0 +1,40 @@
+#include "particleAverageMonitor.hpp"
+#include <monitors/logs/stdOut.hpp>
+
+ablate::monitors::ParticleAverageMonitor::ParticleAverageMonitor(std::vector<std::string> fields, int interval, std::shared_ptr<logs::Log> logIn)
+    : fields(fields), interval(interval), log(logIn ? logIn : std::make_shared<logs::StdOut>()) {}
+
+void ablate::monitors::ParticleAverageMonitor::Register(std::shared_ptr<Monitorable> object) {
+    particles = std::dynamic_pointer_cast<ablate::particles::Particles>(object);
+    if (!particles) {
+        throw std::invalid_argument("The ParticleAverageMonitor monitor can only be used with ablate::particles::Particles");
+    }
+    log->Initialize(PetscObjectComm((PetscObject)particles->GetDM()));
+}
+
+PetscErrorCode ablate::monitors::ParticleAverageMonitor::OutputParticleAverage(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx) {
+    PetscFunctionBeginUser;
+    auto monitor = (ablate::monitors::ParticleAverageMonitor*)mctx;
+
+    if (steps == 0 || monitor->interval == 0 || (steps % monitor->interval == 0)) {
+        try {
+            // the weighted values are reduced over every rank
+            const PetscReal totalWeight = monitor->particles->ComputeTotalWeight();
+            monitor->log->Printf("Timestep: %04d time = %-8.4g TotalWeight: %g", (int)steps, (double)time, (double)totalWeight);
+            for (const auto& field : monitor->fields) {
+                auto mean = monitor->particles->ComputeWeightedMean(field);
+                monitor->log->Print("\t ");
+                monitor->log->Print(field.c_str(), mean, "%g");
+            }
+            monitor->log->Print("\n");
+        } catch (std::exception& e) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, e.what());
+        }
+    }
+    PetscFunctionReturn(0);
+}
+
+#include "parser/registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::ParticleAverageMonitor, "reports the total parcel weight and the parcel weighted mean of particle fields",
+         OPT(std::vector<std::string>, "fields", "the real particle fields to average (default is only the total weight)"),
+         OPT(int, "interval", "how often to report the averages (default is every timestep)"), OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"));
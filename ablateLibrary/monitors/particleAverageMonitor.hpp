@@ -0,0 +1,32 @@
+#ifndef ABLATELIBRARY_PARTICLEAVERAGEMONITOR_HPP
+#define ABLATELIBRARY_PARTICLEAVERAGEMONITOR_HPP
+#include <monitors/logs/log.hpp>
+#include <string>
+#include <vector>
+#include "monitor.hpp"
+#include "particles/particles.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Reports the total parcel weight (number of physical particles) and the weighted mean of each requested particle field
+ */
+class ParticleAverageMonitor : public Monitor {
+   private:
+    const std::vector<std::string> fields;
+    const int interval;
+    const std::shared_ptr<logs::Log> log;
+
+    std::shared_ptr<ablate::particles::Particles> particles;
+
+    static PetscErrorCode OutputParticleAverage(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
+
+   public:
+    explicit ParticleAverageMonitor(std::vector<std::string> fields = {}, int interval = {}, std::shared_ptr<logs::Log> log = {});
+
+    void Register(std::shared_ptr<Monitorable>) override;
+    PetscMonitorFunction GetPetscFunction() override { return OutputParticleAverage; }
+};
+}  // namespace ablate::monitors
+
+#endif  // ABLATELIBRARY_PARTICLEAVERAGEMONITOR_HPP
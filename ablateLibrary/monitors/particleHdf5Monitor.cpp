@@ -0,0 +1,48 @@
+#include "particleHdf5Monitor.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::monitors::ParticleHdf5Monitor::ParticleHdf5Monitor(int interval, int stride, int count, std::vector<std::string> fields)
+    : Hdf5Monitor(interval), stride(stride), count(count), fields(fields) {}
+
+void ablate::monitors::ParticleHdf5Monitor::Register(std::shared_ptr<Monitorable> object) {
+    particles = std::dynamic_pointer_cast<ablate::particles::Particles>(object);
+    if (!particles) {
+        throw std::invalid_argument("The ParticleHdf5Monitor monitor can only be used with ablate::particles::Particles");
+    }
+    Hdf5Monitor::Register(object);
+}
+
+PetscErrorCode ablate::monitors::ParticleHdf5Monitor::OutputParticleHdf5(TS ts, PetscInt steps, PetscReal time, Vec u, void *mctx) {
+    PetscFunctionBeginUser;
+    auto monitor = (ablate::monitors::ParticleHdf5Monitor *)mctx;
+
+    if (steps == 0 || monitor->interval == 0 || (steps % monitor->interval == 0)) {
+        PetscErrorCode ierr = PetscLogEventBegin(monitor->outputLogEvent, 0, 0, 0, 0);
+        CHKERRQ(ierr);
+        try {
+            // a fixed count is converted to a stride over the global number of particles at the first output, so the same particles are followed
+            PetscInt outputStride = monitor->stride;
+            if (monitor->count > 0) {
+                if (monitor->countStride == 0) {
+                    PetscInt globalSize;
+                    DMSwarmGetSize(monitor->particles->GetDM(), &globalSize) >> checkError;
+                    monitor->countStride = PetscMax(1, (globalSize + monitor->count - 1) / monitor->count);
+                }
+                outputStride = monitor->countStride;
+            }
+            monitor->particles->ViewSubsample(monitor->petscViewer, monitor->index, time, outputStride, monitor->fields);
+        } catch (std::exception &e) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, e.what());
+        }
+        ierr = PetscLogEventEnd(monitor->outputLogEvent, 0, 0, 0, 0);
+        CHKERRQ(ierr);
+        monitor->index++;
+    }
+    PetscFunctionReturn(0);
+}
+
+#include "parser/registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::ParticleHdf5Monitor, "writes a subsample of the particles and selected fields to an hdf5 file",
+         OPT(int, "interval", "how often to write the HDF5 file (default is every timestep)"), OPT(int, "stride", "write the particles with an id that is a multiple of n (default is every particle)"),
+         OPT(int, "count", "write approximately this many particles, overrides the stride (default is off)"),
+         OPT(std::vector<std::string>, "fields", "the particle fields to write, the coordinates are always written (default is all fields)"));
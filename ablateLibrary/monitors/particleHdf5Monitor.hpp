@@ -0,0 +1,34 @@
+#ifndef ABLATELIBRARY_PARTICLEHDF5MONITOR_HPP
+#define ABLATELIBRARY_PARTICLEHDF5MONITOR_HPP
+#include <string>
+#include <vector>
+#include "hdf5Monitor.hpp"
+#include "particles/particles.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Writes a deterministic subsample of the particles and only the requested fields to an hdf5 file
+ */
+class ParticleHdf5Monitor : public Hdf5Monitor {
+   private:
+    const int stride;
+    const int count;
+    const std::vector<std::string> fields;
+
+    // the stride computed from the count at the first output
+    PetscInt countStride = 0;
+
+    std::shared_ptr<ablate::particles::Particles> particles;
+
+    static PetscErrorCode OutputParticleHdf5(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
+
+   public:
+    explicit ParticleHdf5Monitor(int interval = {}, int stride = {}, int count = {}, std::vector<std::string> fields = {});
+
+    void Register(std::shared_ptr<Monitorable>) override;
+    PetscMonitorFunction GetPetscFunction() override { return OutputParticleHdf5; }
+};
+}  // namespace ablate::monitors
+
+#endif  // ABLATELIBRARY_PARTICLEHDF5MONITOR_HPP
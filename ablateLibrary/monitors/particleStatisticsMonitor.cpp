@@ -0,0 +1,19 @@
+#include "particleStatisticsMonitor.hpp"
+#include "particles/particleStatistics.hpp"
+
+ablate::monitors::ParticleStatisticsMonitor::ParticleStatisticsMonitor(int interval, std::vector<std::string> fields) : Hdf5Monitor(interval), fields(fields) {}
+
+void ablate::monitors::ParticleStatisticsMonitor::Register(std::shared_ptr<Monitorable> object) {
+    auto particles = std::dynamic_pointer_cast<ablate::particles::Particles>(object);
+    if (!particles) {
+        throw std::invalid_argument("The ParticleStatisticsMonitor monitor can only be used with ablate::particles::Particles");
+    }
+
+    // the statistics are written in place of the particles
+    Hdf5Monitor::Register(std::make_shared<ablate::particles::ParticleStatistics>(particles, fields));
+}
+
+#include "parser/registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::ParticleStatisticsMonitor, "bins the particles into per cell count, mean, and variance fields and writes them to an hdf5 file",
+         OPT(int, "interval", "how often to write the HDF5 file (default is every timestep)"),
+         OPT(std::vector<std::string>, "fields", "the real particle fields to compute the mean and variance of (default is only the count)"));
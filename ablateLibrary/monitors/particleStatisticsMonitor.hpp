@@ -0,0 +1,23 @@
+#ifndef ABLATELIBRARY_PARTICLESTATISTICSMONITOR_HPP
+#define ABLATELIBRARY_PARTICLESTATISTICSMONITOR_HPP
+#include <string>
+#include <vector>
+#include "hdf5Monitor.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Writes the per cell particle statistics (count, mean, variance) to an hdf5 file in place of the particles
+ */
+class ParticleStatisticsMonitor : public Hdf5Monitor {
+   private:
+    const std::vector<std::string> fields;
+
+   public:
+    explicit ParticleStatisticsMonitor(int interval = {}, std::vector<std::string> fields = {});
+
+    void Register(std::shared_ptr<Monitorable>) override;
+};
+}  // namespace ablate::monitors
+
+#endif  // ABLATELIBRARY_PARTICLESTATISTICSMONITOR_HPP
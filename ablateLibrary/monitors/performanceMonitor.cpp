@@ -0,0 +1,125 @@
+#include "performanceMonitor.hpp"
+#include <monitors/logs/stdOut.hpp>
+#include <utilities/petscError.hpp>
+
+ablate::monitors::PerformanceMonitor::PerformanceMonitor(int interval, std::vector<std::string> events, std::shared_ptr<logs::Log> logIn)
+    : interval(interval > 0 ? interval : 1), eventNames(events.empty() ? DefaultEvents : events), log(logIn ? logIn : std::make_shared<logs::StdOut>()) {}
+
+void ablate::monitors::PerformanceMonitor::Register(std::shared_ptr<Monitorable>) {
+    // the event information is only recorded if logging is turned on
+    PetscLogDefaultBegin() >> checkError;
+}
+
+void ablate::monitors::PerformanceMonitor::GetEventPerformance(std::vector<PetscLogDouble>& eventTime, std::vector<PetscLogDouble>& eventCount) const {
+    eventTime.assign(eventNames.size(), 0.0);
+    eventCount.assign(eventNames.size(), 0.0);
+
+    for (std::size_t e = 0; e < eventNames.size(); e++) {
+        // events may be registered lazily, so look up the id each time
+        PetscLogEvent event;
+        PetscLogEventGetId(eventNames[e].c_str(), &event) >> checkError;
+        if (event < 0) {
+            continue;
+        }
+
+        PetscEventPerfInfo info;
+        PetscLogEventGetPerfInfo(PETSC_DETERMINE, event, &info) >> checkError;
+        eventTime[e] = info.time;
+        eventCount[e] = info.count;
+    }
+}
+
+PetscErrorCode ablate::monitors::PerformanceMonitor::MonitorPerformance(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx) {
+    PetscFunctionBeginUser;
+    PetscErrorCode ierr;
+
+    PerformanceMonitor* monitor = (PerformanceMonitor*)ctx;
+    MPI_Comm comm = PetscObjectComm((PetscObject)ts);
+
+    PetscLogDouble wallTime;
+    ierr = PetscTime(&wallTime);
+    CHKERRQ(ierr);
+
+    std::vector<PetscLogDouble> eventTime;
+    std::vector<PetscLogDouble> eventCount;
+    try {
+        monitor->GetEventPerformance(eventTime, eventCount);
+    } catch (std::exception& e) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, e.what());
+    }
+
+    // if this is the first time step init the log and record the starting values
+    if (step == 0 || monitor->previousEventTime.empty()) {
+        if (step == 0) {
+            monitor->log->Initialize(comm);
+        }
+        monitor->previousEventTime = eventTime;
+        monitor->previousEventCount = eventCount;
+        monitor->previousWallTime = wallTime;
+        monitor->previousStep = step;
+        PetscFunctionReturn(0);
+    }
+
+    PetscInt numberSteps = step - monitor->previousStep;
+    if (numberSteps < monitor->interval) {
+        PetscFunctionReturn(0);
+    }
+
+    // report the slowest rank for each event, the wall time is stored at the end
+    std::vector<PetscLogDouble> localDelta(eventTime.size() + 1);
+    for (std::size_t e = 0; e < eventTime.size(); e++) {
+        localDelta[e] = eventTime[e] - monitor->previousEventTime[e];
+    }
+    localDelta.back() = wallTime - monitor->previousWallTime;
+    std::vector<PetscLogDouble> maxDelta(localDelta.size());
+    ierr = MPIU_Allreduce(&localDelta[0], &maxDelta[0], (PetscMPIInt)localDelta.size(), MPI_DOUBLE, MPI_MAX, comm);
+    CHKERRQ(ierr);
+
+    // compute the number of cells from the solution size
+    DM dm;
+    ierr = TSGetDM(ts, &dm);
+    CHKERRQ(ierr);
+    PetscDS ds;
+    ierr = DMGetDS(dm, &ds);
+    CHKERRQ(ierr);
+    PetscInt totalComponents;
+    ierr = PetscDSGetTotalComponents(ds, &totalComponents);
+    CHKERRQ(ierr);
+    PetscInt size;
+    ierr = VecGetSize(u, &size);
+    CHKERRQ(ierr);
+    PetscInt numberCells = totalComponents > 0 ? size / totalComponents : 0;
+
+    const PetscLogDouble elapsedTime = maxDelta.back();
+    const PetscLogDouble throughput = elapsedTime > 0 ? ((PetscLogDouble)numberCells * numberSteps) / elapsedTime : 0.0;
+    monitor->log->Printf("Timestep: %04d time = %-8.4g wall time/step = %-8.4g s throughput = %-8.4g cells*steps/s\n",
+                         (int)step,
+                         (double)crtime,
+                         (double)(elapsedTime / numberSteps),
+                         (double)throughput);
+
+    for (std::size_t e = 0; e < monitor->eventNames.size(); e++) {
+        const PetscLogDouble calls = eventCount[e] - monitor->previousEventCount[e];
+        if (calls <= 0) {
+            continue;
+        }
+        monitor->log->Printf("\t %-18s %-10.4g s/step (%5.1f%%) \t calls/step: %g\n",
+                             monitor->eventNames[e].c_str(),
+                             (double)(maxDelta[e] / numberSteps),
+                             elapsedTime > 0 ? (double)(100.0 * maxDelta[e] / elapsedTime) : 0.0,
+                             (double)(calls / numberSteps));
+    }
+
+    monitor->previousEventTime = eventTime;
+    monitor->previousEventCount = eventCount;
+    monitor->previousWallTime = wallTime;
+    monitor->previousStep = step;
+
+    PetscFunctionReturn(0);
+}
+
+#include "parser/registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::PerformanceMonitor, "Reports the time spent in each log event and the throughput in cells*steps/second",
+         OPT(int, "interval", "how often to report the performance (default is every timestep)"),
+         OPT(std::vector<std::string>, "events", "the names of the log events to report (default is the ablate flow, particle, and output events)"),
+         OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"));
@@ -0,0 +1,47 @@
+#ifndef ABLATELIBRARY_PERFORMANCEMONITOR_HPP
+#define ABLATELIBRARY_PERFORMANCEMONITOR_HPP
+#include <monitors/logs/log.hpp>
+#include <string>
+#include <vector>
+#include "monitor.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Uses the PetscLogEvents to report a per step breakdown of where the time is spent along with the throughput in cells*steps/second
+ */
+class PerformanceMonitor : public Monitor {
+   private:
+    const int interval;
+    const std::vector<std::string> eventNames;
+    const std::shared_ptr<logs::Log> log;
+
+    // the event time and count at the last report
+    std::vector<PetscLogDouble> previousEventTime;
+    std::vector<PetscLogDouble> previousEventCount;
+    PetscLogDouble previousWallTime = 0.0;
+    PetscInt previousStep = 0;
+
+    static PetscErrorCode MonitorPerformance(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
+
+    /**
+     * Gets the current time and count for each event in the current stage.  Events that have not been registered are reported as zero.
+     * @param eventTime
+     * @param eventCount
+     */
+    void GetEventPerformance(std::vector<PetscLogDouble>& eventTime, std::vector<PetscLogDouble>& eventCount) const;
+
+   public:
+    inline static const std::vector<std::string> DefaultEvents = {
+        "TSStep", "FVFlowRHS", "FVInsertBoundary", "FVAuxUpdate", "FVGradRecon", "FVFluxResidual", "FVPointResidual", "ParticleAdvect", "ParticleInterp", "ParticleMigrate", "Hdf5Output"};
+
+    explicit PerformanceMonitor(int interval = {}, std::vector<std::string> events = {}, std::shared_ptr<logs::Log> log = {});
+
+    /**
+     * Turns on the default petsc logging so that the event information is recorded
+     */
+    void Register(std::shared_ptr<Monitorable>) override;
+    PetscMonitorFunction GetPetscFunction() override { return MonitorPerformance; }
+};
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_PERFORMANCEMONITOR_HPP
@@ -11,19 +11,8 @@ PetscErrorCode ablate::monitors::SolutionErrorMonitor::MonitorError(TS ts, Petsc
     PetscFunctionBeginUser;
     PetscErrorCode ierr;
     DM dm;
-    PetscDS ds;
     ierr = TSGetDM(ts, &dm);
     CHKERRQ(ierr);
-    ierr = DMGetDS(dm, &ds);
-    CHKERRQ(ierr);
-
-    // Get the number of fields
-    PetscInt numberOfFields;
-    ierr = PetscDSGetNumFields(ds, &numberOfFields);
-    CHKERRQ(ierr);
-    PetscInt* numberComponentsPerField;
-    ierr = PetscDSGetComponents(ds, &numberComponentsPerField);
-    CHKERRQ(ierr);
 
     SolutionErrorMonitor* errorMonitor = (SolutionErrorMonitor*)ctx;
 
@@ -50,22 +39,14 @@ PetscErrorCode ablate::monitors::SolutionErrorMonitor::MonitorError(TS ts, Petsc
             errorMonitor->log->Print("error", ferrors, "%2.3g");
             errorMonitor->log->Print("\n");
             break;
-        case Scope::COMPONENT: {
+        case Scope::COMPONENT:
             errorMonitor->log->Printf("Timestep: %04d time = %-8.4g \t %s error:\n", (int)step, (double)crtime, errorTypeName.c_str());
-            PetscInt fieldOffset = 0;
-            for (PetscInt f = 0; f < numberOfFields; f++) {
-                PetscObject field;
-                ierr = DMGetField(dm, f, NULL, &field);
-                CHKERRQ(ierr);
-                const char* name;
-                PetscObjectGetName((PetscObject)field, &name);
-
-                errorMonitor->log->Print("\t ");
-                errorMonitor->log->Print(name, numberComponentsPerField[f], &ferrors[fieldOffset], "%2.3g");
-                errorMonitor->log->Print("\n");
-                fieldOffset += numberComponentsPerField[f];
+            try {
+                PrintFieldValues(*errorMonitor->log, dm, ferrors);
+            } catch (std::exception& exception) {
+                SETERRQ(PetscObjectComm((PetscObject)dm), PETSC_ERR_LIB, exception.what());
             }
-        } break;
+            break;
         default: {
             SETERRQ(PetscObjectComm((PetscObject)dm), PETSC_ERR_LIB, "Unknown error scope");
         }
@@ -111,11 +92,18 @@ std::vector<PetscReal> ablate::monitors::SolutionErrorMonitor::ComputeError(TS t
     // If we treat this as a single vector or multiple components change how this is done
     totalComponents = errorScope == Scope::VECTOR ? 1 : totalComponents;
 
+    // Compute the l2 errors
+    auto ferrors = ComputeComponentNorms(exactVec, totalComponents, normType);
+
+    VecDestroy(&exactVec) >> checkError;
+    return ferrors;
+}
+
+std::vector<PetscReal> ablate::monitors::SolutionErrorMonitor::ComputeComponentNorms(Vec vec, PetscInt numberComponents, ablate::monitors::SolutionErrorMonitor::Norm normType) {
     // Update the block size
-    VecSetBlockSize(exactVec, totalComponents) >> checkError;
+    VecSetBlockSize(vec, numberComponents) >> checkError;
 
-    // Compute the l2 errors
-    std::vector<PetscReal> ferrors(totalComponents);
+    std::vector<PetscReal> norms(numberComponents);
     NormType petscNormType;
     switch (normType) {
         case Norm::L2_NORM:
@@ -132,20 +120,40 @@ std::vector<PetscReal> ablate::monitors::SolutionErrorMonitor::ComputeError(TS t
     }
 
     // compute the norm along the stride
-    VecStrideNormAll(exactVec, petscNormType, &ferrors[0]) >> checkError;
+    VecStrideNormAll(vec, petscNormType, &norms[0]) >> checkError;
 
-    // normalize the error if _norm
+    // normalize the values if _norm
     if (normType == Norm::L2_NORM) {
         PetscInt size;
-        VecGetSize(exactVec, &size);
-        PetscReal factor = PetscSqrtReal(1.0 / (size / totalComponents));
-        for (PetscInt c = 0; c < totalComponents; c++) {
-            ferrors[c] *= factor;
+        VecGetSize(vec, &size) >> checkError;
+        PetscReal factor = PetscSqrtReal(1.0 / (size / numberComponents));
+        for (PetscInt c = 0; c < numberComponents; c++) {
+            norms[c] *= factor;
         }
     }
+    return norms;
+}
 
-    VecDestroy(&exactVec) >> checkError;
-    return ferrors;
+void ablate::monitors::SolutionErrorMonitor::PrintFieldValues(ablate::monitors::logs::Log& log, DM dm, const std::vector<PetscReal>& values) {
+    PetscDS ds;
+    DMGetDS(dm, &ds) >> checkError;
+    PetscInt numberOfFields;
+    PetscDSGetNumFields(ds, &numberOfFields) >> checkError;
+    PetscInt* numberComponentsPerField;
+    PetscDSGetComponents(ds, &numberComponentsPerField) >> checkError;
+
+    PetscInt fieldOffset = 0;
+    for (PetscInt f = 0; f < numberOfFields; f++) {
+        PetscObject field;
+        DMGetField(dm, f, NULL, &field) >> checkError;
+        const char* name;
+        PetscObjectGetName(field, &name) >> checkError;
+
+        log.Print("\t ");
+        log.Print(name, numberComponentsPerField[f], &values[fieldOffset], "%2.3g");
+        log.Print("\n");
+        fieldOffset += numberComponentsPerField[f];
+    }
 }
 
 std::ostream& ablate::monitors::operator<<(std::ostream& os, const ablate::monitors::SolutionErrorMonitor::Scope& v) {
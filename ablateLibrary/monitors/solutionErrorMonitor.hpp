@@ -25,6 +25,23 @@ class SolutionErrorMonitor : public Monitor {
     PetscMonitorFunction GetPetscFunction() override { return MonitorError; }
 
     std::vector<PetscReal> ComputeError(TS ts, PetscReal time, Vec u);
+
+    /**
+     * Compute the norm of each component in a vector holding numberComponents interlaced components.  The vector block size is updated.
+     * @param vec
+     * @param numberComponents
+     * @param normType
+     * @return
+     */
+    static std::vector<PetscReal> ComputeComponentNorms(Vec vec, PetscInt numberComponents, Norm normType);
+
+    /**
+     * Print the component values for each field in the dm on its own line
+     * @param log
+     * @param dm
+     * @param values
+     */
+    static void PrintFieldValues(logs::Log& log, DM dm, const std::vector<PetscReal>& values);
 };
 
 /**
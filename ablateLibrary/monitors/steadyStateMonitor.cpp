@@ -0,0 +1,146 @@
+#include "steadyStateMonitor.hpp"
+#include <monitors/logs/stdOut.hpp>
+#include <sstream>
+#include <utilities/petscError.hpp>
+
+ablate::monitors::SteadyStateMonitor::SteadyStateMonitor(double tolerance, double relativeTolerance, ablate::monitors::SolutionErrorMonitor::Norm normType, bool useRhs,
+                                                         std::shared_ptr<logs::Log> logIn)
+    : tolerance(tolerance), relativeTolerance(relativeTolerance), normType(normType), useRhs(useRhs), log(logIn ? logIn : std::make_shared<logs::StdOut>()) {}
+
+ablate::monitors::SteadyStateMonitor::~SteadyStateMonitor() {
+    if (previousSolution) {
+        VecDestroy(&previousSolution) >> checkError;
+    }
+}
+
+void ablate::monitors::SteadyStateMonitor::Register(std::shared_ptr<Monitorable> monitorableObject) {
+    auto flow = std::dynamic_pointer_cast<ablate::flow::Flow>(monitorableObject);
+    if (!flow) {
+        throw std::invalid_argument("The SteadyStateMonitor monitor can only be used with ablate::flow::Flow");
+    }
+
+    // the convergence reason can only be set after the step is taken
+    flow->RegisterPostStep([this](TS ts, ablate::flow::Flow& flow) { this->CheckSteadyState(ts, flow); });
+}
+
+PetscErrorCode ablate::monitors::SteadyStateMonitor::MonitorSteadyState(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx) {
+    PetscFunctionBeginUser;
+    PetscErrorCode ierr;
+
+    SteadyStateMonitor* monitor = (SteadyStateMonitor*)ctx;
+
+    // if this is the first time step init the log
+    if (step == 0) {
+        monitor->log->Initialize(PetscObjectComm((PetscObject)ts));
+    }
+
+    // store the solution at the start of the step
+    if (!monitor->useRhs) {
+        if (monitor->previousSolution) {
+            PetscInt previousSize, size;
+            ierr = VecGetLocalSize(monitor->previousSolution, &previousSize);
+            CHKERRQ(ierr);
+            ierr = VecGetLocalSize(u, &size);
+            CHKERRQ(ierr);
+            if (previousSize != size) {
+                ierr = VecDestroy(&monitor->previousSolution);
+                CHKERRQ(ierr);
+            }
+        }
+        if (!monitor->previousSolution) {
+            ierr = VecDuplicate(u, &monitor->previousSolution);
+            CHKERRQ(ierr);
+        }
+        ierr = VecCopy(u, monitor->previousSolution);
+        CHKERRQ(ierr);
+    }
+
+    PetscFunctionReturn(0);
+}
+
+void ablate::monitors::SteadyStateMonitor::CheckSteadyState(TS ts, ablate::flow::Flow& flow) {
+    PetscInt step;
+    TSGetStepNumber(ts, &step) >> checkError;
+    PetscReal time;
+    TSGetTime(ts, &time) >> checkError;
+    Vec u;
+    TSGetSolution(ts, &u) >> checkError;
+
+    // the previous solution may not match if the dm changed during the step
+    if (!useRhs) {
+        PetscInt previousSize, size;
+        VecGetLocalSize(previousSolution, &previousSize) >> checkError;
+        VecGetLocalSize(u, &size) >> checkError;
+        if (previousSize != size) {
+            return;
+        }
+    }
+
+    auto residual = ComputeResidual(ts, flow, u);
+    if (initialResidual.empty()) {
+        initialResidual = residual;
+    }
+
+    // check each component
+    bool converged = true;
+    for (std::size_t c = 0; c < residual.size(); c++) {
+        bool componentConverged = residual[c] <= tolerance || (relativeTolerance > 0 && residual[c] <= relativeTolerance * initialResidual[c]);
+        converged = converged && componentConverged;
+    }
+
+    // output the residual for each field
+    DM dm;
+    TSGetDM(ts, &dm) >> checkError;
+    std::stringstream normTypeStream;
+    normTypeStream << normType;
+    log->Printf("Timestep: %04d time = %-8.4g \t %s residual:\n", (int)step, (double)time, normTypeStream.str().c_str());
+    SolutionErrorMonitor::PrintFieldValues(*log, dm, residual);
+
+    if (converged) {
+        log->Printf("Steady state reached at timestep %04d\n", (int)step);
+        TSSetConvergedReason(ts, TS_CONVERGED_USER) >> checkError;
+    }
+}
+
+std::vector<PetscReal> ablate::monitors::SteadyStateMonitor::ComputeResidual(TS ts, ablate::flow::Flow& flow, Vec u) {
+    DM dm;
+    PetscDS ds;
+    TSGetDM(ts, &dm) >> checkError;
+    DMGetDS(dm, &ds) >> checkError;
+
+    // compute the total number of components
+    PetscInt numberOfFields;
+    PetscDSGetNumFields(ds, &numberOfFields) >> checkError;
+    PetscInt* numberComponentsPerField;
+    PetscDSGetComponents(ds, &numberComponentsPerField) >> checkError;
+    PetscInt totalComponents = 0;
+    for (PetscInt f = 0; f < numberOfFields; ++f) {
+        totalComponents += numberComponentsPerField[f];
+    }
+
+    // compute the residual as either the rhs or the rate of change of the solution
+    Vec residualVec;
+    VecDuplicate(u, &residualVec) >> checkError;
+    if (useRhs) {
+        PetscReal time;
+        TSGetTime(ts, &time) >> checkError;
+        flow.ComputeRHSFunction(ts, time, u, residualVec);
+    } else {
+        PetscReal time, previousTime;
+        TSGetTime(ts, &time) >> checkError;
+        TSGetPrevTime(ts, &previousTime) >> checkError;
+        VecWAXPY(residualVec, -1.0, previousSolution, u) >> checkError;
+        VecScale(residualVec, 1.0 / (time - previousTime)) >> checkError;
+    }
+    auto residual = SolutionErrorMonitor::ComputeComponentNorms(residualVec, totalComponents, normType);
+
+    VecDestroy(&residualVec) >> checkError;
+    return residual;
+}
+
+#include "parser/registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::SteadyStateMonitor, "Reports the residual of each field every time step and stops the solve once steady state is reached",
+         ARG(double, "tolerance", "the absolute tolerance that each component residual must be below"),
+         OPT(double, "relativeTolerance", "optional tolerance relative to the first residual (default is off)"),
+         ENUM(ablate::monitors::SolutionErrorMonitor::Norm, "type", "norm type ('l2', 'linf', 'l2_norm')"),
+         OPT(bool, "rhs", "use the norm of the rhs instead of the change in solution per time (default is false)"), OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"));
@@ -0,0 +1,55 @@
+#ifndef ABLATELIBRARY_STEADYSTATEMONITOR_HPP
+#define ABLATELIBRARY_STEADYSTATEMONITOR_HPP
+#include <flow/flow.hpp>
+#include <monitors/logs/log.hpp>
+#include <vector>
+#include "monitor.hpp"
+#include "solutionErrorMonitor.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Computes the per field/component norm of the flow residual (the rhs or the change in solution over the step) and stops the time stepper once it is below the tolerance
+ */
+class SteadyStateMonitor : public Monitor {
+   private:
+    const double tolerance;
+    const double relativeTolerance;
+    const SolutionErrorMonitor::Norm normType;
+    const bool useRhs;
+    const std::shared_ptr<logs::Log> log;
+
+    // the solution at the start of the step, only used when the rhs is not
+    Vec previousSolution = nullptr;
+
+    // the first residual computed, used for the relative tolerance
+    std::vector<PetscReal> initialResidual;
+
+    static PetscErrorCode MonitorSteadyState(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
+
+    /**
+     * called after each flow step to check for convergence
+     * @param ts
+     * @param flow
+     */
+    void CheckSteadyState(TS ts, flow::Flow& flow);
+
+   public:
+    SteadyStateMonitor(double tolerance, double relativeTolerance, SolutionErrorMonitor::Norm normType, bool useRhs, std::shared_ptr<logs::Log> log = {});
+    ~SteadyStateMonitor() override;
+
+    void Register(std::shared_ptr<Monitorable>) override;
+    PetscMonitorFunction GetPetscFunction() override { return MonitorSteadyState; }
+
+    /**
+     * Compute the norm of the residual for each component in the solution.  The rhs residual does not include any local time step scaling.
+     * @param ts
+     * @param flow
+     * @param u
+     * @return
+     */
+    std::vector<PetscReal> ComputeResidual(TS ts, flow::Flow& flow, Vec u);
+};
+
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_STEADYSTATEMONITOR_HPP
@@ -1,12 +1,13 @@
 #include "inertial.hpp"
+#include <cmath>
 #include <utilities/petscError.hpp>
 
 enum InertialParticleFields { Position, Velocity, TotalParticleField };
 
 ablate::particles::Inertial::Inertial(std::string name, int ndims, std::shared_ptr<parameters::Parameters> parameters, std::shared_ptr<particles::initializers::Initializer> initializer,
                                       std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::shared_ptr<mathFunctions::MathFunction> exactSolution,
-                                      std::shared_ptr<parameters::Parameters> options)
-    : Particles(name, ndims, initializer, fieldInitialization, exactSolution, options) {
+                                      std::shared_ptr<parameters::Parameters> options, std::shared_ptr<particles::initializers::Initializer> injector)
+    : Particles(name, ndims, initializer, fieldInitialization, exactSolution, options, parameters, injector), exponentialDrag(parameters->Get<bool>("exponentialDrag", false)) {
     RegisterSolutionField(ParticleFieldDescriptor{.fieldName = ParticleVelocity, .components = ndims, .type = PETSC_REAL});
     RegisterField(ParticleFieldDescriptor{.fieldName = FluidVelocity, .components = ndims, .type = PETSC_REAL});
     RegisterField(ParticleFieldDescriptor{.fieldName = ParticleDiameter, .components = 1, .type = PETSC_REAL});
@@ -25,7 +26,13 @@ void ablate::particles::Inertial::InitializeFlow(std::shared_ptr<flow::Flow> flo
     // Call the base to initialize the flow
     Particles::InitializeFlow(flow);
 
-    TSSetRHSFunction(particleTs, NULL, RHSFunction, this) >> checkError;
+    if (exponentialDrag) {
+        // each forward euler step applies the exponential drag step, so the ts monitors and exact error checks still run
+        TSSetType(particleTs, TSEULER) >> checkError;
+        TSSetRHSFunction(particleTs, NULL, ExponentialDragRHSFunction, this) >> checkError;
+    } else {
+        TSSetRHSFunction(particleTs, NULL, RHSFunction, this) >> checkError;
+    }
 
     // Set the start time for TSSolve
     TSSetTime(particleTs, timeInitial) >> checkError;
@@ -34,56 +41,15 @@ void ablate::particles::Inertial::InitializeFlow(std::shared_ptr<flow::Flow> flo
     flow->RegisterPostStep([this](TS flowTs, ablate::flow::Flow &) { this->AdvectParticles(flowTs); });
 }
 
-PetscErrorCode ablate::particles::Inertial::UnpackKinematics(TS ts, Vec kinematics, Vec position, Vec velocity) {
-    PetscScalar *pos, *vel;
-    const PetscScalar *kin;
-    PetscInt Np, p, dim, n;
-    PetscErrorCode ierr;
-    DM dm;
-
-    PetscFunctionBeginUser;
-    ierr = TSGetDM(ts, &dm);
-    CHKERRQ(ierr);
-    ierr = DMGetDimension(dm, &dim);
-    CHKERRQ(ierr);
-    ierr = VecGetArrayRead(kinematics, &kin);
-    CHKERRQ(ierr);
-    ierr = VecGetArray(position, &pos);
-    CHKERRQ(ierr);
-    ierr = VecGetArray(velocity, &vel);
-    CHKERRQ(ierr);
-    ierr = VecGetLocalSize(position, &Np);
-    CHKERRQ(ierr);
-
-    Np /= dim;
-    for (p = 0; p < Np; ++p) {
-        for (n = 0; n < dim; n++) {
-            pos[p * dim + n] = kin[p * TotalParticleField * dim + n];
-            vel[p * dim + n] = kin[p * TotalParticleField * dim + dim + n];
-        }
-    }
-    ierr = VecRestoreArrayRead(kinematics, &kin);
-    CHKERRQ(ierr);
-    ierr = VecRestoreArray(position, &pos);
-    CHKERRQ(ierr);
-    ierr = VecRestoreArray(velocity, &vel);
-    CHKERRQ(ierr);
-    PetscFunctionReturn(0);
-}
-
 PetscErrorCode ablate::particles::Inertial::RHSFunction(TS ts, PetscReal t, Vec X, Vec F, void *ctx) {
     PetscFunctionBeginUser;
 
     ablate::particles::Inertial *particles = (ablate::particles::Inertial *)ctx;
 
-    Vec u = particles->flowFinal;
-    DM sdm, dm, vdm;
-    Vec vel, locvel, fluidVelocity;
-    IS vis;
-    DMInterpolationInfo ictx;
-    const PetscScalar *coords;
+    DM sdm, dm;
+    Vec fluidVelocity;
+    const PetscScalar *x;
     PetscScalar *f;
-    PetscInt vf[1] = {particles->flowVelocityFieldIndex};
     PetscInt dim, Np;
     PetscErrorCode ierr;
 
@@ -101,72 +67,28 @@ PetscErrorCode ablate::particles::Inertial::RHSFunction(TS ts, PetscReal t, Vec
     ierr = DMGetDimension(dm, &dim);
     CHKERRQ(ierr);
 
-    /* Get local fluid velocity */
-    ierr = DMCreateSubDM(dm, 1, vf, &vis, &vdm);
-    CHKERRQ(ierr);
-    ierr = VecGetSubVector(u, vis, &vel);
-    CHKERRQ(ierr);
-    ierr = DMGetLocalVector(vdm, &locvel);
-    CHKERRQ(ierr);
-    ierr = DMPlexInsertBoundaryValues(vdm, PETSC_TRUE, locvel, particles->timeInitial, NULL, NULL, NULL);
-    CHKERRQ(ierr);
-    ierr = DMGlobalToLocalBegin(vdm, vel, INSERT_VALUES, locvel);
-    CHKERRQ(ierr);
-    ierr = DMGlobalToLocalEnd(vdm, vel, INSERT_VALUES, locvel);
-    CHKERRQ(ierr);
-    ierr = VecRestoreSubVector(u, vis, &vel);
-    CHKERRQ(ierr);
-    ierr = ISDestroy(&vis);
-    CHKERRQ(ierr);
-
-    /* Interpolate velocity */
-    ierr = DMInterpolationCreate(PETSC_COMM_SELF, &ictx);
+    // The particle position and velocity are read directly from the kinematics, the diameter and density from the swarm
+    const PetscReal *partDiam, *partDens;
+    ierr = VecGetArrayRead(X, &x);
     CHKERRQ(ierr);
-    ierr = DMInterpolationSetDim(ictx, dim);
+    ierr = DMSwarmGetField(sdm, ParticleDiameter, NULL, NULL, (void **)&partDiam);
     CHKERRQ(ierr);
-    ierr = DMInterpolationSetDof(ictx, dim);
+    ierr = DMSwarmGetField(sdm, ParticleDensity, NULL, NULL, (void **)&partDens);
     CHKERRQ(ierr);
 
-    // Get particle position, velocity, diameter and density
-    Vec particlePosition, particleVelocity, particleDiameter, particleDensity;
-    ierr = DMSwarmCreateGlobalVectorFromField(sdm, DMSwarmPICField_coor, &particlePosition);
-    CHKERRQ(ierr);
-    ierr = DMSwarmCreateGlobalVectorFromField(sdm, ParticleVelocity, &particleVelocity);
-    CHKERRQ(ierr);
-    ierr = DMSwarmCreateGlobalVectorFromField(sdm, ParticleDiameter, &particleDiameter);
-    CHKERRQ(ierr);
-    ierr = DMSwarmCreateGlobalVectorFromField(sdm, ParticleDensity, &particleDensity);
-    CHKERRQ(ierr);
-
-    // Unpack kinematics to get updated position and velocity
-    ierr = UnpackKinematics(ts, X, particlePosition, particleVelocity);
-    CHKERRQ(ierr);
-    ierr = VecGetArrayRead(particlePosition, &coords);
-    CHKERRQ(ierr);
-    ierr = DMInterpolationAddPoints(ictx, Np, (PetscReal *)coords);
-    CHKERRQ(ierr);
-    ierr = VecRestoreArrayRead(particlePosition, &coords);
-    CHKERRQ(ierr);
-
-    /* Particles that lie outside the domain should be dropped,
-     whereas particles that move to another partition should trigger a migration */
-    ierr = DMInterpolationSetUp(ictx, vdm, PETSC_FALSE, PETSC_TRUE);
-    CHKERRQ(ierr);
-    ierr = VecSet(fluidVelocity, 0.);
-    CHKERRQ(ierr);
-
-    ierr = DMInterpolationEvaluate(ictx, vdm, locvel, fluidVelocity);
-    CHKERRQ(ierr);
-    ierr = DMInterpolationDestroy(&ictx);
-    CHKERRQ(ierr);
-    ierr = DMRestoreLocalVector(vdm, &locvel);
-    CHKERRQ(ierr);
-    ierr = DMDestroy(&vdm);
+    /* Interpolate velocity at the stage positions */
+    particles->stagePositions.resize(Np * dim);
+    for (PetscInt p = 0; p < Np; ++p) {
+        for (PetscInt n = 0; n < dim; n++) {
+            particles->stagePositions[p * dim + n] = x[p * TotalParticleField * dim + n];
+        }
+    }
+    ierr = particles->InterpolateFlowVelocity(t, Np, particles->stagePositions.data(), fluidVelocity);
     CHKERRQ(ierr);
 
     // Calculate RHS of particle position and velocity equations
     PetscInt p, n;
-    const PetscScalar *partVel, *fluidVel, *partDiam, *partDens;
+    const PetscScalar *fluidVel;
     PetscReal g[3] = {particles->gravityField[0], particles->gravityField[1], particles->gravityField[2]};  // gravity field
     PetscScalar muF = particles->fluidViscosity;
     PetscScalar rhoF = particles->fluidDensity;
@@ -174,21 +96,19 @@ PetscErrorCode ablate::particles::Inertial::RHSFunction(TS ts, PetscReal t, Vec
     PetscReal Rep, corFactor;
     PetscScalar tauP;  // particle Stokes relaxation time
 
-    ierr = VecGetArray(F, &f);
+    // the padding past the local particles does not change
+    ierr = VecZeroEntries(F);
     CHKERRQ(ierr);
-    ierr = VecGetArrayRead(particleVelocity, &partVel);
+    ierr = VecGetArray(F, &f);
     CHKERRQ(ierr);
     ierr = VecGetArrayRead(fluidVelocity, &fluidVel);
     CHKERRQ(ierr);
-    ierr = VecGetArrayRead(particleDensity, &partDens);
-    CHKERRQ(ierr);
-    ierr = VecGetArrayRead(particleDiameter, &partDiam);
-    CHKERRQ(ierr);
 
     for (p = 0; p < Np; ++p) {
+        const PetscScalar *partVel = x + p * TotalParticleField * dim + dim;
         Rep = 0.0;
         for (n = 0; n < dim; n++) {
-            Rep += rhoF * PetscSqr(fluidVel[p * dim + n] - partVel[p * dim + n]) * partDiam[p] / muF;
+            Rep += rhoF * PetscSqr(fluidVel[p * dim + n] - partVel[n]) * partDiam[p] / muF;
         }
         // Correction factor to account for finite Rep on Stokes drag (see Schiller-Naumann drag closure)
         corFactor = 1.0 + 0.15 * PetscPowReal(PetscSqrtReal(Rep), 0.687);
@@ -198,36 +118,146 @@ PetscErrorCode ablate::particles::Inertial::RHSFunction(TS ts, PetscReal t, Vec
         // Note: this function assumed that the solution vector order is correct
         tauP = partDens[p] * PetscSqr(partDiam[p]) / (18.0 * muF);  // particle relaxation time
         for (n = 0; n < dim; n++) {
-            f[p * TotalParticleField * dim + n] = partVel[p * dim + n];
-            f[p * TotalParticleField * dim + dim + n] = corFactor * (fluidVel[p * dim + n] - partVel[p * dim + n]) / tauP + g[n] * (1.0 - rhoF / partDens[p]);
+            f[p * TotalParticleField * dim + n] = partVel[n];
+            f[p * TotalParticleField * dim + dim + n] = corFactor * (fluidVel[p * dim + n] - partVel[n]) / tauP + g[n] * (1.0 - rhoF / partDens[p]);
         }
     }
     ierr = VecRestoreArray(F, &f);
     CHKERRQ(ierr);
-    ierr = VecRestoreArrayRead(particleVelocity, &partVel);
-    CHKERRQ(ierr);
     ierr = VecRestoreArrayRead(fluidVelocity, &fluidVel);
     CHKERRQ(ierr);
-    ierr = VecRestoreArrayRead(particleDensity, &partDens);
-    CHKERRQ(ierr);
-    ierr = VecRestoreArrayRead(particleDiameter, &partDiam);
+    ierr = VecRestoreArrayRead(X, &x);
     CHKERRQ(ierr);
-    ierr = DMSwarmDestroyGlobalVectorFromField(sdm, FluidVelocity, &fluidVelocity);
-    CHKERRQ(ierr);
-    ierr = DMSwarmDestroyGlobalVectorFromField(sdm, DMSwarmPICField_coor, &particlePosition);
+    ierr = DMSwarmRestoreField(sdm, ParticleDiameter, NULL, NULL, (void **)&partDiam);
     CHKERRQ(ierr);
-    ierr = DMSwarmDestroyGlobalVectorFromField(sdm, ParticleVelocity, &particleVelocity);
+    ierr = DMSwarmRestoreField(sdm, ParticleDensity, NULL, NULL, (void **)&partDens);
     CHKERRQ(ierr);
-    ierr = DMSwarmDestroyGlobalVectorFromField(sdm, ParticleDiameter, &particleDiameter);
+    ierr = DMSwarmDestroyGlobalVectorFromField(sdm, FluidVelocity, &fluidVelocity);
     CHKERRQ(ierr);
-    ierr = DMSwarmDestroyGlobalVectorFromField(sdm, ParticleDensity, &particleDensity);
+    PetscFunctionReturn(0);
+}
+
+void ablate::particles::Inertial::ExponentialDragStep(PetscReal h, PetscInt np, const PetscScalar *initial, const PetscReal *fluidVelocity, PetscScalar *final) const {
+    const PetscInt dim = ndims;
+
+    // Get the particle diameter and density
+    const PetscReal *partDiam, *partDens;
+    DMSwarmGetField(dm, ParticleDiameter, NULL, NULL, (void **)&partDiam) >> checkError;
+    DMSwarmGetField(dm, ParticleDensity, NULL, NULL, (void **)&partDens) >> checkError;
+
+    for (PetscInt p = 0; p < np; ++p) {
+        const PetscScalar *position = initial + p * TotalParticleField * dim;
+        const PetscScalar *partVel = position + dim;
+        const PetscReal *fluidVel = fluidVelocity + p * dim;
+
+        // Correction factor to account for finite Rep on Stokes drag (see Schiller-Naumann drag closure), frozen over the step
+        PetscReal Rep = 0.0;
+        for (PetscInt n = 0; n < dim; n++) {
+            Rep += fluidDensity * PetscSqr(fluidVel[n] - partVel[n]) * partDiam[p] / fluidViscosity;
+        }
+        PetscReal corFactor = 1.0 + 0.15 * PetscPowReal(PetscSqrtReal(Rep), 0.687);
+        if (Rep < 0.1) {
+            corFactor = 1.0;  // returns Stokes drag for low speed particles
+        }
+
+        // effective relaxation time including the correction
+        const PetscReal tauP = partDens[p] * PetscSqr(partDiam[p]) / (18.0 * fluidViscosity) / corFactor;
+        const PetscReal decay = PetscExpReal(-h / tauP);
+        const PetscReal oneMinusDecay = -std::expm1(-h / tauP);
+
+        for (PetscInt n = 0; n < dim; n++) {
+            // the velocity the particle relaxes to under drag and buoyancy-corrected gravity
+            const PetscReal terminalVelocity = fluidVel[n] + tauP * gravityField[n] * (1.0 - fluidDensity / partDens[p]);
+            final[p * TotalParticleField * dim + n] = position[n] + terminalVelocity * h + (partVel[n] - terminalVelocity) * tauP * oneMinusDecay;
+            final[p * TotalParticleField * dim + dim + n] = terminalVelocity + (partVel[n] - terminalVelocity) * decay;
+        }
+    }
+
+    DMSwarmRestoreField(dm, ParticleDiameter, NULL, NULL, (void **)&partDiam) >> checkError;
+    DMSwarmRestoreField(dm, ParticleDensity, NULL, NULL, (void **)&partDens) >> checkError;
+}
+
+PetscErrorCode ablate::particles::Inertial::ExponentialDragRHSFunction(TS ts, PetscReal t, Vec X, Vec F, void *ctx) {
+    PetscFunctionBeginUser;
+    ablate::particles::Inertial *particles = (ablate::particles::Inertial *)ctx;
+    PetscErrorCode ierr;
+
+    PetscReal h;
+    ierr = TSGetTimeStep(ts, &h);
     CHKERRQ(ierr);
+
+    try {
+        PetscInt np;
+        DMSwarmGetLocalSize(particles->dm, &np) >> checkError;
+        const PetscInt dim = particles->ndims;
+
+        // the fluid velocity is interpolated into the swarm field and then copied out
+        Vec fluidVelocity;
+        DMSwarmCreateGlobalVectorFromField(particles->dm, FluidVelocity, &fluidVelocity) >> checkError;
+        auto sampleFluidVelocity = [&](PetscReal time, const PetscScalar *kinematics, std::vector<PetscReal> &sampled) {
+            particles->stagePositions.resize(np * dim);
+            for (PetscInt p = 0; p < np; ++p) {
+                for (PetscInt n = 0; n < dim; n++) {
+                    particles->stagePositions[p * dim + n] = kinematics[p * TotalParticleField * dim + n];
+                }
+            }
+            particles->InterpolateFlowVelocity(time, np, particles->stagePositions.data(), fluidVelocity) >> checkError;
+            const PetscScalar *fluidVelocityArray;
+            VecGetArrayRead(fluidVelocity, &fluidVelocityArray) >> checkError;
+            sampled.assign(fluidVelocityArray, fluidVelocityArray + np * dim);
+            VecRestoreArrayRead(fluidVelocity, &fluidVelocityArray) >> checkError;
+        };
+
+        // the padding past the local particles does not change
+        VecZeroEntries(F) >> checkError;
+        const PetscScalar *x;
+        PetscScalar *f;
+        VecGetArrayRead(X, &x) >> checkError;
+        VecGetArray(F, &f) >> checkError;
+
+        // predict the end of step kinematics with the fluid velocity at the start of the step
+        sampleFluidVelocity(t, x, particles->fluidVelocityInitial);
+        particles->ExponentialDragStep(h, np, x, particles->fluidVelocityInitial.data(), f);
+
+        // correct using the average of the fluid velocity at the start and predicted end of the step
+        sampleFluidVelocity(t + h, f, particles->fluidVelocityFinal);
+        for (PetscInt i = 0; i < np * dim; ++i) {
+            particles->fluidVelocityFinal[i] = 0.5 * (particles->fluidVelocityInitial[i] + particles->fluidVelocityFinal[i]);
+        }
+        particles->ExponentialDragStep(h, np, x, particles->fluidVelocityFinal.data(), f);
+
+        // convert the end of step kinematics to the rate used by the forward euler step
+        for (PetscInt i = 0; i < np * TotalParticleField * dim; ++i) {
+            f[i] = (f[i] - x[i]) / h;
+        }
+
+        VecRestoreArray(F, &f) >> checkError;
+        VecRestoreArrayRead(X, &x) >> checkError;
+        DMSwarmDestroyGlobalVectorFromField(particles->dm, FluidVelocity, &fluidVelocity) >> checkError;
+    } catch (std::exception &exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, exception.what());
+    }
     PetscFunctionReturn(0);
 }
 
+void ablate::particles::Inertial::IntegrateParticles(Vec solution) {
+    // the exponential drag step is stable for any step size relative to the particle relaxation time, so the whole flow step is taken at once
+    if (exponentialDrag && timeFinal > timeInitial) {
+        TSSetTimeStep(particleTs, timeFinal - timeInitial) >> checkError;
+    }
+    Particles::IntegrateParticles(solution);
+}
+
 #include "parser/registrar.hpp"
 REGISTER(ablate::particles::Particles, ablate::particles::Inertial, "particles (with mass) that advect with the flow", ARG(std::string, "name", "the name of the particle group"),
-         ARG(int, "ndims", "the number of dimensions for the particle"), ARG(parameters::Parameters, "parameters", "fluid parameters for the particles (fluidDensity, fluidViscosity, gravityField)"),
+         ARG(int, "ndims", "the number of dimensions for the particle"),
+         ARG(parameters::Parameters, "parameters",
+             "fluid parameters for the particles (fluidDensity, fluidViscosity, gravityField) and the optional particle parameters: sortFrequency (sort the particles by cell "
+             "every n flow steps, default is off), flowInterpolationOrder (interpolate the flow velocity in time, 1 linear or 2 quadratic, default is 0 the end of step flow), "
+             "partitionWeight (the cost of each particle relative to a flow cell when repartitioning a FVFlow, default is 0), injectionInterval (inject particles every n flow "
+             "steps, default is every step), exponentialDrag (integrate the drag exactly over each flow step with the fluid velocity frozen, using a forward euler particle "
+             "ts, default is false)"),
          ARG(particles::initializers::Initializer, "initializer", "the initial particle setup methods"),
          ARG(std::vector<mathFunctions::FieldFunction>, "fieldInitialization", "the initial particle fields setup methods"),
-         OPT(mathFunctions::MathFunction, "exactSolution", "the particle location/velocity exact solution"), ARG(parameters::Parameters, "options", "options to be passed to petsc"));
\ No newline at end of file
+         OPT(mathFunctions::MathFunction, "exactSolution", "the particle location/velocity exact solution"), ARG(parameters::Parameters, "options", "options to be passed to petsc"),
+         OPT(particles::initializers::Initializer, "injector", "optional initializer used to inject new particles during the simulation (only the BoxInitializer supports injection)"));
\ No newline at end of file
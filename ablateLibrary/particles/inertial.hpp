@@ -19,10 +19,27 @@ class Inertial : public Particles {
      */
     static PetscErrorCode PackKinematics(TS ts, Vec position, Vec velocity, Vec kinematics);
 
-    /*
-     * Unpack kinematics to get particle position and velocity
+    // the particle positions at the current rk stage, stored to avoid reallocating each rhs evaluation
+    std::vector<PetscReal> stagePositions;
+
+    // integrate the drag exactly over each particle ts step (with the fluid velocity frozen)
+    const bool exponentialDrag;
+
+    // the fluid velocity at the start and end of the exponential step
+    std::vector<PetscReal> fluidVelocityInitial;
+    std::vector<PetscReal> fluidVelocityFinal;
+
+    /**
+     * Advances each particle over the step assuming a constant fluid velocity.  Because the Stokes drag is linear in the particle velocity, the velocity
+     * relaxes exponentially towards the terminal velocity, v = vInf + (v0 - vInf) e^(-h/tau), and the position is the integral of that velocity.  This is stable
+     * for any step size relative to the particle relaxation time.
+     * @param h the step size
+     * @param np
+     * @param initial the kinematics at the start of the step
+     * @param fluidVelocity the fluid velocity at each particle (np*dim)
+     * @param final the kinematics at the end of the step
      */
-    static PetscErrorCode UnpackKinematics(TS ts, Vec kinematics, Vec position, Vec velocity);
+    void ExponentialDragStep(PetscReal h, PetscInt np, const PetscScalar *initial, const PetscReal *fluidVelocity, PetscScalar *final) const;
 
     /* calculating RHS of the following equations
      * x_t = vp
@@ -30,14 +47,26 @@ class Inertial : public Particles {
      */
     static PetscErrorCode RHSFunction(TS ts, PetscReal t, Vec X, Vec F, void *ctx);
 
+    /**
+     * Computes the rate that advances the kinematics by the exponential drag step over the current ts step, F = (X_exp(t + dt) - X)/dt, so that a forward euler
+     * step of the particle ts applies the exponential step.  The fluid velocity is the average of the fluid velocity at the start and the predicted end of the step.
+     */
+    static PetscErrorCode ExponentialDragRHSFunction(TS ts, PetscReal t, Vec X, Vec F, void *ctx);
+
    public:
     Inertial(std::string name, int ndims, std::shared_ptr<parameters::Parameters> parameters, std::shared_ptr<particles::initializers::Initializer> initializer,
              std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::shared_ptr<mathFunctions::MathFunction> exactSolution = {},
-             std::shared_ptr<parameters::Parameters> options = {});
+             std::shared_ptr<parameters::Parameters> options = {}, std::shared_ptr<particles::initializers::Initializer> injector = {});
     ~Inertial() override;
 
     void InitializeFlow(std::shared_ptr<flow::Flow> flow) override;
 
+    /**
+     * Takes the whole flow step with a single particle ts step when using the exponential drag
+     * @param solution
+     */
+    void IntegrateParticles(Vec solution) override;
+
     inline static const char FluidVelocity[] = "FluidVelocity";
 };
 
@@ -1,10 +1,94 @@
 #include "boxInitializer.hpp"
+#include <algorithm>
+#include <map>
+#include "utilities/mpiError.hpp"
 #include "utilities/petscError.hpp"
 
-ablate::particles::initializers::BoxInitializer::BoxInitializer(std::vector<double> lowerBound, std::vector<double> upperBound, int particlesPerDim)
-    : lowerBound(lowerBound), upperBound(upperBound), particlesPerDim(particlesPerDim){};
+ablate::particles::initializers::BoxInitializer::BoxInitializer(std::vector<double> lowerBound, std::vector<double> upperBound, int particlesPerDim, double weight)
+    : lowerBound(lowerBound), upperBound(upperBound), particlesPerDim(particlesPerDim), weight(weight == 0.0 ? 1.0 : weight) {
+    if (this->weight < 0.0) {
+        throw std::invalid_argument("The BoxInitializer weight must be positive");
+    }
+}
+
+/**
+ * A point on a face or vertex shared between ranks may be located by more than one rank, possibly only in overlap cells.  Each lattice index is sent to a rank
+ * chosen by the index, which keeps exactly one copy: the lowest rank that located the point in an owned cell, otherwise the lowest rank that located it at all.
+ */
+static void ResolvePointOwnership(MPI_Comm comm, PetscInt dim, std::vector<PetscReal> &coordinates, std::vector<PetscInt> &cells, std::vector<PetscInt> &latticeIndices,
+                                  const std::vector<PetscInt> &owned) {
+    PetscMPIInt size, rank;
+    MPI_Comm_size(comm, &size) >> checkMpiError;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+
+    // sort the local (index, priority) pairs by the rank that checks them
+    const PetscInt np = latticeIndices.size();
+    std::vector<PetscMPIInt> sendCounts(size, 0), sendOffsets(size, 0), receiveCounts(size), receiveOffsets(size, 0);
+    for (PetscInt p = 0; p < np; ++p) {
+        sendCounts[latticeIndices[p] % size] += 2;
+    }
+    for (PetscMPIInt r = 1; r < size; ++r) {
+        sendOffsets[r] = sendOffsets[r - 1] + sendCounts[r - 1];
+    }
+    std::vector<PetscInt> sendPairs(2 * np), sendOrder(np);
+    std::vector<PetscMPIInt> position = sendOffsets;
+    for (PetscInt p = 0; p < np; ++p) {
+        const PetscMPIInt destination = latticeIndices[p] % size;
+        sendOrder[position[destination] / 2] = p;
+        sendPairs[position[destination]++] = latticeIndices[p];
+        sendPairs[position[destination]++] = owned[p] ? rank : size + rank;
+    }
+
+    MPI_Alltoall(sendCounts.data(), 1, MPI_INT, receiveCounts.data(), 1, MPI_INT, comm) >> checkMpiError;
+    for (PetscMPIInt r = 1; r < size; ++r) {
+        receiveOffsets[r] = receiveOffsets[r - 1] + receiveCounts[r - 1];
+    }
+    const PetscMPIInt receiveSize = receiveOffsets[size - 1] + receiveCounts[size - 1];
+    std::vector<PetscInt> receivePairs(receiveSize);
+    MPI_Alltoallv(sendPairs.data(), sendCounts.data(), sendOffsets.data(), MPIU_INT, receivePairs.data(), receiveCounts.data(), receiveOffsets.data(), MPIU_INT, comm) >>
+        checkMpiError;
+
+    // the copy with the lowest priority is kept
+    std::map<PetscInt, PetscInt> bestPriority;
+    for (PetscMPIInt i = 0; i < receiveSize; i += 2) {
+        auto existing = bestPriority.find(receivePairs[i]);
+        if (existing == bestPriority.end() || receivePairs[i + 1] < existing->second) {
+            bestPriority[receivePairs[i]] = receivePairs[i + 1];
+        }
+    }
+    std::vector<PetscInt> receiveKeep(receiveSize);
+    for (PetscMPIInt i = 0; i < receiveSize; i += 2) {
+        receiveKeep[i] = receiveKeep[i + 1] = bestPriority[receivePairs[i]] == receivePairs[i + 1];
+    }
+    std::vector<PetscInt> sendKeep(2 * np);
+    MPI_Alltoallv(receiveKeep.data(), receiveCounts.data(), receiveOffsets.data(), MPIU_INT, sendKeep.data(), sendCounts.data(), sendOffsets.data(), MPIU_INT, comm) >> checkMpiError;
+
+    std::vector<bool> keep(np);
+    for (PetscInt i = 0; i < np; ++i) {
+        keep[sendOrder[i]] = sendKeep[2 * i];
+    }
+    PetscInt kept = 0;
+    for (PetscInt p = 0; p < np; ++p) {
+        if (keep[p]) {
+            std::copy(coordinates.begin() + p * dim, coordinates.begin() + (p + 1) * dim, coordinates.begin() + kept * dim);
+            cells[kept] = cells[p];
+            latticeIndices[kept] = latticeIndices[p];
+            kept++;
+        }
+    }
+    coordinates.resize(kept * dim);
+    cells.resize(kept);
+    latticeIndices.resize(kept);
+}
+
+void ablate::particles::initializers::BoxInitializer::ComputeLocalBoxPoints(DM cellDM, std::vector<PetscReal> &coordinates, std::vector<PetscInt> &cells,
+                                                                            std::vector<PetscInt> &latticeIndices) const {
+    PetscInt dim;
+    DMGetDimension(cellDM, &dim) >> checkError;
+    if (dim < 1 || dim > 3) {
+        throw std::runtime_error("Do not support particle layout in dimension " + std::to_string(dim));
+    }
 
-void ablate::particles::initializers::BoxInitializer::Initialize(ablate::flow::Flow &flow, DM particleDm) {
     /* The initial number of particles per box dimension */
     PetscInt Npb = (PetscInt)particlesPerDim;
 
@@ -22,76 +106,108 @@ void ablate::particles::initializers::BoxInitializer::Initialize(ablate::flow::F
         partUpper[i] = upperBound[i];
     }
 
-    PetscInt dim;
-    DMGetDimension(particleDm, &dim) >> checkError;
-
-    PetscInt Np = 1;
-    PetscInt *cellid, n[3];
-    PetscReal x[3], dx[3];
-    PetscScalar *coords;
-    PetscMPIInt rank;
-
-    DMSetFromOptions(particleDm) >> checkError;
-    MPI_Comm_rank(PetscObjectComm((PetscObject)particleDm), &rank);
+    // only generate the part of the lattice inside the local bounding box
+    PetscReal localLower[3], localUpper[3];
+    DMGetLocalBoundingBox(cellDM, localLower, localUpper) >> checkError;
 
+    PetscInt Np = 1, npLocal = 1;
+    PetscInt n[3], stride[3], iStart[3], iEnd[3];
+    PetscReal dx[3];
     for (PetscInt d = 0; d < dim; ++d) {
         n[d] = Npb;
         dx[d] = (partUpper[d] - partLower[d]) / PetscMax(1, n[d] - 1);
+        stride[d] = Np;
         Np *= n[d];
+
+        if (dx[d] > 0.0) {
+            const PetscReal tolerance = PETSC_SQRT_MACHINE_EPSILON;
+            iStart[d] = PetscMax(0, (PetscInt)PetscCeilReal((localLower[d] - partLower[d]) / dx[d] - tolerance));
+            iEnd[d] = PetscMin(n[d], (PetscInt)PetscFloorReal((localUpper[d] - partLower[d]) / dx[d] + tolerance) + 1);
+        } else {
+            iStart[d] = 0;
+            iEnd[d] = partLower[d] >= localLower[d] && partLower[d] <= localUpper[d] ? n[d] : 0;
+        }
+        npLocal *= PetscMax(0, iEnd[d] - iStart[d]);
     }
 
-    // Initialize all particles on rank 0 and then distribute
-    if (rank != 0) {
-        Np = 0;
+    std::vector<PetscReal> candidates(npLocal * dim);
+    std::vector<PetscInt> candidateIndices(npLocal);
+    for (PetscInt l = 0; l < npLocal; ++l) {
+        // the first dimension varies fastest, matching the lattice index
+        PetscInt remainder = l;
+        PetscInt index = 0;
+        for (PetscInt d = 0; d < dim; ++d) {
+            const PetscInt localSize = iEnd[d] - iStart[d];
+            const PetscInt i = iStart[d] + remainder % localSize;
+            remainder /= localSize;
+            candidates[l * dim + d] = partLower[d] + i * dx[d];
+            index += i * stride[d];
+        }
+        candidateIndices[l] = index;
     }
 
+    // keep the particles located in a local cell
+    coordinates = std::move(candidates);
+    std::vector<PetscInt> owned;
+    auto located = LocateLocalPoints(cellDM, coordinates, cells, owned);
+    latticeIndices.resize(located.size());
+    for (std::size_t p = 0; p < located.size(); ++p) {
+        latticeIndices[p] = candidateIndices[located[p]];
+    }
+
+    // make sure that each lattice point is kept by exactly one rank
+    ResolvePointOwnership(PetscObjectComm((PetscObject)cellDM), dim, coordinates, cells, latticeIndices, owned);
+}
+
+void ablate::particles::initializers::BoxInitializer::Initialize(ablate::flow::Flow &flow, DM particleDm) {
+    DMSetFromOptions(particleDm) >> checkError;
+
+    // each rank creates the particles in the cells it owns, so no migration is needed
+    std::vector<PetscReal> coordinates;
+    std::vector<PetscInt> cells;
+    std::vector<PetscInt> latticeIndices;
+    ComputeLocalBoxPoints(flow.GetDM(), coordinates, cells, latticeIndices);
+    const PetscInt Np = cells.size();
+
     DMSwarmSetLocalSizes(particleDm, Np, 0) >> checkError;
     DMSetFromOptions(particleDm) >> checkError;
+
+    PetscScalar *coords;
     DMSwarmGetField(particleDm, DMSwarmPICField_coor, NULL, NULL, (void **)&coords) >> checkError;
-    if (rank == 0) {
-        switch (dim) {
-            case 2:
-                x[0] = partLower[0];
-                for (PetscInt i = 0; i < n[0]; ++i, x[0] += dx[0]) {
-                    x[1] = partLower[1];
-                    for (PetscInt j = 0; j < n[1]; ++j, x[1] += dx[1]) {
-                        const PetscInt p = j * n[0] + i;
-                        for (PetscInt d = 0; d < dim; ++d) {
-                            coords[p * dim + d] = x[d];
-                        }
-                    }
-                }
-                break;
-            case 3:
-                x[0] = partLower[0];
-                for (PetscInt i = 0; i < n[0]; ++i, x[0] += dx[0]) {
-                    x[1] = partLower[1];
-                    for (PetscInt j = 0; j < n[1]; ++j, x[1] += dx[1]) {
-                        x[2] = partLower[2];
-                        for (PetscInt k = 0; k < n[2]; ++k, x[2] += dx[2]) {
-                            const PetscInt p = (k * n[1] + j) * n[0] + i;
-                            for (PetscInt d = 0; d < dim; ++d) {
-                                coords[p * dim + d] = x[d];
-                            }
-                        }
-                    }
-                }
-                break;
-            default:
-                throw std::runtime_error("Do not support particle layout in dimension " + std::to_string(dim));
-        }
-    }
+    std::copy(coordinates.begin(), coordinates.end(), coords);
     DMSwarmRestoreField(particleDm, DMSwarmPICField_coor, NULL, NULL, (void **)&coords) >> checkError;
+
+    PetscInt *cellid;
     DMSwarmGetField(particleDm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellid) >> checkError;
-    for (PetscInt p = 0; p < Np; ++p) {
-        cellid[p] = 0;
-    }
+    std::copy(cells.begin(), cells.end(), cellid);
     DMSwarmRestoreField(particleDm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellid) >> checkError;
-    DMSwarmMigrate(particleDm, PETSC_TRUE) >> checkError;
+
+    // the particle id is the location in the box so that it does not depend upon the number of ranks
+    PetscInt64 *pid;
+    DMSwarmGetField(particleDm, DMSwarmField_pid, NULL, NULL, (void **)&pid) >> checkError;
+    std::copy(latticeIndices.begin(), latticeIndices.end(), pid);
+    DMSwarmRestoreField(particleDm, DMSwarmField_pid, NULL, NULL, (void **)&pid) >> checkError;
+
+    SetParcelWeight(particleDm, weight);
+}
+
+PetscInt ablate::particles::initializers::BoxInitializer::ComputeInjection(DM cellDM, std::vector<PetscReal> &coordinates, std::vector<PetscInt> &cells, std::vector<PetscReal> &weights,
+                                                                          std::vector<PetscInt> &ids) {
+    ComputeLocalBoxPoints(cellDM, coordinates, cells, ids);
+    weights.assign(cells.size(), weight);
+
+    // the ids are the lattice index in the box
+    PetscInt dim;
+    DMGetDimension(cellDM, &dim) >> checkError;
+    PetscInt idRange = 1;
+    for (PetscInt d = 0; d < dim; ++d) {
+        idRange *= particlesPerDim;
+    }
+    return idRange;
 }
 
 #include "parser/registrar.hpp"
 
 REGISTER(ablate::particles::initializers::Initializer, ablate::particles::initializers::BoxInitializer, "simple box initializer that puts particles in a defined box",
          ARG(std::vector<double>, "lower", "the lower bound of the box"), ARG(std::vector<double>, "upper", "the upper bound of the box"),
-         ARG(int, "particlesPerDim", "the particles per box dimension"));
\ No newline at end of file
+         ARG(int, "particlesPerDim", "the particles per box dimension"), OPT(double, "weight", "the number of physical particles represented by each particle parcel (default is 1)"));
\ No newline at end of file
@@ -8,12 +8,26 @@ class BoxInitializer : public Initializer {
     const std::vector<double> lowerBound;
     const std::vector<double> upperBound;
     const int particlesPerDim;
+    const double weight;
 
    public:
-    explicit BoxInitializer(std::vector<double> lowerBound = {0, 0, 0}, std::vector<double> upperBound = {1.0, 1.0, 1.0}, int particlesPerDim = 1);
+    explicit BoxInitializer(std::vector<double> lowerBound = {0, 0, 0}, std::vector<double> upperBound = {1.0, 1.0, 1.0}, int particlesPerDim = 1, double weight = 1.0);
     ~BoxInitializer() = default;
 
+    /**
+     * Computes the evenly spaced particle locations in the box that belong to this rank.  Each point in the box is returned by exactly one rank, preferring a rank
+     * that owns the containing cell.  Only the part of the box overlapping the local bounding box is generated, so each rank does work proportional to its own
+     * particles and the layout does not depend on the number of ranks.
+     * @param cellDM
+     * @param coordinates the coordinates of each local particle (n*dim)
+     * @param cells the local cell containing each particle
+     * @param latticeIndices the index of each local particle in the full box
+     */
+    void ComputeLocalBoxPoints(DM cellDM, std::vector<PetscReal>& coordinates, std::vector<PetscInt>& cells, std::vector<PetscInt>& latticeIndices) const;
+
     void Initialize(ablate::flow::Flow& flow, DM particleDM) override;
+
+    PetscInt ComputeInjection(DM cellDM, std::vector<PetscReal>& coordinates, std::vector<PetscInt>& cells, std::vector<PetscReal>& weights, std::vector<PetscInt>& ids) override;
 };
 }  // namespace ablate::particles::initializers
 
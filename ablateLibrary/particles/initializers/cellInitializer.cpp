@@ -2,7 +2,11 @@
 #include "parser/registrar.hpp"
 #include "utilities/petscError.hpp"
 
-ablate::particles::initializers::CellInitializer::CellInitializer(int particlesPerCellPerDim) : particlesPerCell(particlesPerCellPerDim) {}
+ablate::particles::initializers::CellInitializer::CellInitializer(int particlesPerCellPerDim, double weight) : particlesPerCell(particlesPerCellPerDim), weight(weight == 0.0 ? 1.0 : weight) {
+    if (this->weight < 0.0) {
+        throw std::invalid_argument("The CellInitializer weight must be positive");
+    }
+}
 
 void ablate::particles::initializers::CellInitializer::Initialize(ablate::flow::Flow &flow, DM particleDm) {
     PetscInt particlesPerCell = (PetscInt)this->particlesPerCell;
@@ -23,7 +27,9 @@ void ablate::particles::initializers::CellInitializer::Initialize(ablate::flow::
 
     DMSwarmRestoreField(particleDm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellid) >> checkError;
     DMSwarmSetPointCoordinatesRandom(particleDm, particlesPerCell) >> checkError;
+    SetParcelWeight(particleDm, weight);
 }
 
 REGISTER(ablate::particles::initializers::Initializer, ablate::particles::initializers::CellInitializer, "simple cell initializer that puts particles in every element",
-         ARG(int, "particlesPerCellPerDim", "particles per cell per dimension"));
\ No newline at end of file
+         ARG(int, "particlesPerCellPerDim", "particles per cell per dimension"),
+         OPT(double, "weight", "the number of physical particles represented by each particle parcel (default is 1)"));
\ No newline at end of file
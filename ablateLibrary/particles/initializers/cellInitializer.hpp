@@ -6,9 +6,10 @@ namespace ablate::particles::initializers {
 class CellInitializer : public Initializer {
    private:
     const int particlesPerCell;
+    const double weight;
 
    public:
-    explicit CellInitializer(int particlesPerCellPerDim = 1);
+    explicit CellInitializer(int particlesPerCellPerDim = 1, double weight = 1.0);
     ~CellInitializer() override = default;
 
     void Initialize(ablate::flow::Flow& flow, DM particleDM) override;
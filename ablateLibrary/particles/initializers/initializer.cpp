@@ -0,0 +1,100 @@
+#include "initializer.hpp"
+#include "particles/particles.hpp"
+#include "utilities/petscError.hpp"
+
+void ablate::particles::initializers::Initializer::SetParcelWeight(DM particleDM, PetscReal weight) {
+    PetscInt np;
+    DMSwarmGetLocalSize(particleDM, &np) >> checkError;
+
+    if (weight <= 0.0) {
+        throw std::invalid_argument("The particle parcel weight must be positive, not " + std::to_string(weight));
+    }
+
+    PetscReal *weightField;
+    DMSwarmGetField(particleDM, ablate::particles::Particles::ParticleWeight, NULL, NULL, (void **)&weightField) >> checkError;
+    for (PetscInt p = 0; p < np; ++p) {
+        weightField[p] = weight;
+    }
+    DMSwarmRestoreField(particleDM, ablate::particles::Particles::ParticleWeight, NULL, NULL, (void **)&weightField) >> checkError;
+}
+
+std::vector<PetscInt> ablate::particles::initializers::Initializer::LocateLocalPoints(DM cellDM, std::vector<PetscReal> &coordinates, std::vector<PetscInt> &cells,
+                                                                                     std::vector<PetscInt> &owned) {
+    PetscInt dim;
+    DMGetDimension(cellDM, &dim) >> checkError;
+
+    // quickly discard anything outside of the local domain
+    PetscReal lower[3], upper[3];
+    DMGetLocalBoundingBox(cellDM, lower, upper) >> checkError;
+    std::vector<PetscReal> candidates;
+    std::vector<PetscInt> candidateIndices;
+    const PetscInt np = coordinates.size() / dim;
+    for (PetscInt p = 0; p < np; ++p) {
+        bool inside = true;
+        for (PetscInt d = 0; d < dim; ++d) {
+            inside = inside && coordinates[p * dim + d] >= lower[d] && coordinates[p * dim + d] <= upper[d];
+        }
+        if (inside) {
+            candidates.insert(candidates.end(), coordinates.begin() + p * dim, coordinates.begin() + (p + 1) * dim);
+            candidateIndices.push_back(p);
+        }
+    }
+    coordinates.clear();
+    cells.clear();
+    owned.clear();
+    std::vector<PetscInt> locatedIndices;
+    const PetscInt numberCandidates = candidateIndices.size();
+    if (numberCandidates == 0) {
+        return locatedIndices;
+    }
+
+    // only interior cells can hold particles
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(cellDM, 0, &cStart, &cEnd) >> checkError;
+    PetscInt ghostStart;
+    DMPlexGetGhostCellStratum(cellDM, &ghostStart, NULL) >> checkError;
+    if (ghostStart >= 0) {
+        cEnd = ghostStart;
+    }
+
+    // the leaves of the point sf are the cells owned by another rank
+    std::vector<PetscInt> ownedCell(cEnd - cStart, 1);
+    PetscSF pointSF;
+    DMGetPointSF(cellDM, &pointSF) >> checkError;
+    PetscInt numberLeaves;
+    const PetscInt *leaves;
+    PetscSFGetGraph(pointSF, NULL, &numberLeaves, &leaves, NULL) >> checkError;
+    for (PetscInt l = 0; l < PetscMax(numberLeaves, 0); ++l) {
+        const PetscInt point = leaves ? leaves[l] : l;
+        if (point >= cStart && point < cEnd) {
+            ownedCell[point - cStart] = 0;
+        }
+    }
+
+    // locate the remaining points in the local domain
+    Vec pointVec;
+    VecCreateSeqWithArray(PETSC_COMM_SELF, dim, numberCandidates * dim, candidates.data(), &pointVec) >> checkError;
+    PetscSF cellSF = NULL;
+    DMLocatePoints(cellDM, pointVec, DM_POINTLOCATION_NONE, &cellSF) >> checkError;
+    const PetscSFNode *locatedCells;
+    PetscSFGetGraph(cellSF, NULL, NULL, NULL, &locatedCells) >> checkError;
+
+    for (PetscInt p = 0; p < numberCandidates; ++p) {
+        const PetscInt cell = locatedCells[p].index;
+        if (cell < cStart || cell >= cEnd) {
+            continue;
+        }
+        coordinates.insert(coordinates.end(), candidates.begin() + p * dim, candidates.begin() + (p + 1) * dim);
+        cells.push_back(cell);
+        owned.push_back(ownedCell[cell - cStart]);
+        locatedIndices.push_back(candidateIndices[p]);
+    }
+
+    PetscSFDestroy(&cellSF) >> checkError;
+    VecDestroy(&pointVec) >> checkError;
+    return locatedIndices;
+}
+
+PetscInt ablate::particles::initializers::Initializer::ComputeInjection(DM, std::vector<PetscReal> &, std::vector<PetscInt> &, std::vector<PetscReal> &, std::vector<PetscInt> &) {
+    throw std::invalid_argument("This particle initializer does not support injection");
+}
@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_INITIALIZER_HPP
 #include <map>
 #include <string>
+#include <vector>
 #include "flow/flow.hpp"
 
 namespace ablate::particles::initializers {
@@ -9,11 +10,42 @@ class Initializer {
    protected:
     PetscOptions petscOptions;
 
+    /**
+     * Sets the number of physical particles represented by each local parcel.  This must be called after the local size is set.
+     * @param particleDM
+     * @param weight the parcel weight, must be positive
+     */
+    static void SetParcelWeight(DM particleDM, PetscReal weight);
+
+    /**
+     * Keeps only the points that are in a local (owned or overlap) interior cell.  A point on a face between ranks may be kept by more than one rank, so the
+     * caller must resolve the ownership.
+     * @param cellDM
+     * @param coordinates the candidate points (n*dim), on output the located points
+     * @param cells on output the cell containing each remaining point
+     * @param owned on output one if the cell is owned by this rank, zero if it is an overlap cell
+     * @return the index of each remaining point in the candidate points
+     */
+    static std::vector<PetscInt> LocateLocalPoints(DM cellDM, std::vector<PetscReal>& coordinates, std::vector<PetscInt>& cells, std::vector<PetscInt>& owned);
+
    public:
     Initializer() = default;
     virtual ~Initializer() = default;
 
     virtual void Initialize(ablate::flow::Flow& flow, DM particleDM) = 0;
+
+    /**
+     * Computes the particles to add to the local domain when this initializer is used for injection.  Each particle is returned by exactly one rank in a local cell so
+     * that it can be added directly without a migration.  The result may only depend on the cell dm, so the caller can reuse it until the dm changes.  By default
+     * injection is not supported.
+     * @param cellDM the flow dm
+     * @param coordinates the coordinates of each new particle (n*dim)
+     * @param cells the local cell of each new particle
+     * @param weights the parcel weight of each new particle
+     * @param ids an id for each new particle that is unique within one injection and independent of the number of ranks
+     * @return the number of possible ids in one injection, the same on every rank
+     */
+    virtual PetscInt ComputeInjection(DM cellDM, std::vector<PetscReal>& coordinates, std::vector<PetscInt>& cells, std::vector<PetscReal>& weights, std::vector<PetscInt>& ids);
 };
 }  // namespace ablate::particles::initializers
 
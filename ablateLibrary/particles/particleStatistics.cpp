@@ -0,0 +1,224 @@
+#include "particleStatistics.hpp"
+#include <petscviewerhdf5.h>
+#include "generators.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::particles::ParticleStatistics::ParticleStatistics(std::shared_ptr<Particles> particles, std::vector<std::string> fields)
+    : particles(particles), fields(fields), name(particles->GetName() + "Statistics") {}
+
+ablate::particles::ParticleStatistics::~ParticleStatistics() {
+    if (statisticsDM) {
+        DMDestroy(&statisticsDM) >> checkError;
+    }
+    if (segmentViewer) {
+        PetscViewerDestroy(&segmentViewer) >> checkError;
+    }
+
+    // generate the xdmf file for each additional file, the monitor does this for the original
+    int rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    if (rank == 0) {
+        for (const auto& segmentFile : segmentFiles) {
+            if (std::filesystem::exists(segmentFile)) {
+                petscXdmfGenerator::Generate(segmentFile);
+            }
+        }
+    }
+}
+
+void ablate::particles::ParticleStatistics::CreateStatisticsDM(DM swarm, DM cellDM, const std::string& name, const std::vector<std::string>& fields, DM* statisticsDM) {
+    // Create a copy of the dm for the statistics
+    DM coordDM;
+    DMGetCoordinateDM(cellDM, &coordDM) >> checkError;
+    DMClone(cellDM, statisticsDM) >> checkError;
+    DMSetCoordinateDM(*statisticsDM, coordDM) >> checkError;
+    PetscObjectSetName((PetscObject)*statisticsDM, name.c_str()) >> checkError;
+
+    auto addField = [statisticsDM](const std::string& fieldName, PetscInt components) {
+        PetscFV fvm;
+        PetscFVCreate(PetscObjectComm((PetscObject)*statisticsDM), &fvm) >> checkError;
+        PetscObjectSetName((PetscObject)fvm, fieldName.c_str()) >> checkError;
+        PetscFVSetNumComponents(fvm, components) >> checkError;
+        DMAddField(*statisticsDM, NULL, (PetscObject)fvm) >> checkError;
+        PetscFVDestroy(&fvm) >> checkError;
+    };
+
+    // the (weighted) number of particles in each cell
+    addField("count", 1);
+
+    // the mean and variance of each field
+    for (const auto& field : fields) {
+        addField(field + "_mean", GetFieldComponents(swarm, field));
+        addField(field + "_variance", GetFieldComponents(swarm, field));
+    }
+    DMCreateDS(*statisticsDM) >> checkError;
+}
+
+PetscInt ablate::particles::ParticleStatistics::GetFieldComponents(DM swarm, const std::string& field) {
+    PetscInt components;
+    PetscDataType type;
+    void* data;
+    DMSwarmGetField(swarm, field.c_str(), &components, &type, &data) >> checkError;
+    DMSwarmRestoreField(swarm, field.c_str(), NULL, NULL, &data) >> checkError;
+    if (type != PETSC_REAL) {
+        throw std::invalid_argument("ParticleStatistics only supports PETSC_REAL fields, " + field + " is not");
+    }
+    return components;
+}
+
+void ablate::particles::ParticleStatistics::ComputeStatistics(DM swarm, DM statisticsDM, const std::vector<std::string>& fields, Vec statistics) {
+    const std::size_t nf = fields.size();
+    std::vector<PetscInt> fieldComponents(nf);
+    for (std::size_t f = 0; f < nf; ++f) {
+        fieldComponents[f] = GetFieldComponents(swarm, fields[f]);
+    }
+
+    PetscInt np;
+    DMSwarmGetLocalSize(swarm, &np) >> checkError;
+    PetscInt* cellid;
+    const PetscReal* weight;
+    DMSwarmGetField(swarm, DMSwarmPICField_cellid, NULL, NULL, (void**)&cellid) >> checkError;
+    DMSwarmGetField(swarm, Particles::ParticleWeight, NULL, NULL, (void**)&weight) >> checkError;
+    std::vector<const PetscReal*> fieldData(nf);
+    for (std::size_t f = 0; f < nf; ++f) {
+        DMSwarmGetField(swarm, fields[f].c_str(), NULL, NULL, (void**)&fieldData[f]) >> checkError;
+    }
+
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(statisticsDM, 0, &cStart, &cEnd) >> checkError;
+
+    // the variance is computed with two passes over the particles to avoid the cancellation in E[x^2] - E[x]^2.  The first pass sums the weight and weighted value
+    // in the local cells, the second sums the weighted square deviation from the mean.
+    Vec localStatistics, localMeans;
+    DMGetLocalVector(statisticsDM, &localStatistics) >> checkError;
+    DMGetLocalVector(statisticsDM, &localMeans) >> checkError;
+    for (int pass = 0; pass < 2; ++pass) {
+        VecZeroEntries(localStatistics) >> checkError;
+        PetscScalar* localArray;
+        const PetscScalar* meanArray = nullptr;
+        VecGetArray(localStatistics, &localArray) >> checkError;
+        if (pass == 1) {
+            VecGetArrayRead(localMeans, &meanArray) >> checkError;
+        }
+
+        for (PetscInt p = 0; p < np; ++p) {
+            if (cellid[p] < 0) {
+                continue;
+            }
+            PetscScalar* cellStatistics;
+            DMPlexPointLocalRef(statisticsDM, cellid[p], localArray, &cellStatistics) >> checkError;
+            if (!cellStatistics) {
+                continue;
+            }
+            const PetscScalar* cellMeans = nullptr;
+            if (pass == 0) {
+                cellStatistics[0] += weight[p];
+            } else {
+                DMPlexPointLocalRead(statisticsDM, cellid[p], meanArray, &cellMeans) >> checkError;
+            }
+
+            // the dofs of each field are stored one after the other
+            PetscInt offset = 1;
+            for (std::size_t f = 0; f < nf; ++f) {
+                const PetscInt nc = fieldComponents[f];
+                for (PetscInt c = 0; c < nc; ++c) {
+                    const PetscReal value = fieldData[f][p * nc + c];
+                    if (pass == 0) {
+                        cellStatistics[offset + c] += weight[p] * value;
+                    } else {
+                        const PetscReal deviation = value - cellMeans[offset + c];
+                        cellStatistics[offset + nc + c] += weight[p] * deviation * deviation;
+                    }
+                }
+                offset += 2 * nc;
+            }
+        }
+
+        if (pass == 1) {
+            VecRestoreArrayRead(localMeans, &meanArray) >> checkError;
+        }
+        VecRestoreArray(localStatistics, &localArray) >> checkError;
+
+        // particles in overlap cells are added to the owning rank.  The second pass only adds to the (zero) variance dofs.
+        if (pass == 0) {
+            VecZeroEntries(statistics) >> checkError;
+        }
+        DMLocalToGlobal(statisticsDM, localStatistics, ADD_VALUES, statistics) >> checkError;
+
+        // normalize the sums in each owned cell
+        PetscScalar* globalArray;
+        VecGetArray(statistics, &globalArray) >> checkError;
+        for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+            PetscScalar* cellStatistics;
+            DMPlexPointGlobalRef(statisticsDM, cell, globalArray, &cellStatistics) >> checkError;
+            if (!cellStatistics || cellStatistics[0] <= 0.0) {
+                continue;
+            }
+            const PetscReal totalWeight = cellStatistics[0];
+            PetscInt offset = 1;
+            for (std::size_t f = 0; f < nf; ++f) {
+                const PetscInt nc = fieldComponents[f];
+                for (PetscInt c = 0; c < nc; ++c) {
+                    cellStatistics[offset + (pass == 0 ? 0 : nc) + c] /= totalWeight;
+                }
+                offset += 2 * nc;
+            }
+        }
+        VecRestoreArray(statistics, &globalArray) >> checkError;
+
+        // share the mean with the overlap cells for the second pass
+        if (pass == 0) {
+            DMGlobalToLocal(statisticsDM, statistics, INSERT_VALUES, localMeans) >> checkError;
+        }
+    }
+    DMRestoreLocalVector(statisticsDM, &localMeans) >> checkError;
+    DMRestoreLocalVector(statisticsDM, &localStatistics) >> checkError;
+
+    for (std::size_t f = 0; f < nf; ++f) {
+        DMSwarmRestoreField(swarm, fields[f].c_str(), NULL, NULL, (void**)&fieldData[f]) >> checkError;
+    }
+    DMSwarmRestoreField(swarm, Particles::ParticleWeight, NULL, NULL, (void**)&weight) >> checkError;
+    DMSwarmRestoreField(swarm, DMSwarmPICField_cellid, NULL, NULL, (void**)&cellid) >> checkError;
+}
+
+void ablate::particles::ParticleStatistics::View(PetscViewer viewer, PetscInt steps, PetscReal time, Vec) const {
+    // rebuild the statistics dm if the particles have a new cell dm
+    DM swarm = particles->GetDM();
+    DM currentCellDM;
+    DMSwarmGetCellDM(swarm, &currentCellDM) >> checkError;
+    if (!statisticsDM || currentCellDM != cellDM) {
+        const bool rebuilt = statisticsDM != nullptr;
+        if (statisticsDM) {
+            DMDestroy(&statisticsDM) >> checkError;
+        }
+        cellDM = currentCellDM;
+        CreateStatisticsDM(swarm, cellDM, name, fields, &statisticsDM);
+
+        // the mesh layout changed (e.g. the flow was repartitioned), so the statistics from here on are written with the new mesh to a new file next to the original
+        if (rebuilt) {
+            OpenSegmentViewer(viewer);
+            segmentStart = steps;
+        }
+        DMView(statisticsDM, segmentViewer ? segmentViewer : viewer) >> checkError;
+    }
+    DMSetOutputSequenceNumber(statisticsDM, steps - segmentStart, time) >> checkError;
+
+    Vec statistics;
+    DMGetGlobalVector(statisticsDM, &statistics) >> checkError;
+    PetscObjectSetName((PetscObject)statistics, name.c_str()) >> checkError;
+    ComputeStatistics(swarm, statisticsDM, fields, statistics);
+    VecView(statistics, segmentViewer ? segmentViewer : viewer) >> checkError;
+    DMRestoreGlobalVector(statisticsDM, &statistics) >> checkError;
+}
+
+void ablate::particles::ParticleStatistics::OpenSegmentViewer(PetscViewer viewer) const {
+    if (segmentViewer) {
+        PetscViewerDestroy(&segmentViewer) >> checkError;
+    }
+    const char* fileName;
+    PetscViewerFileGetName(viewer, &fileName) >> checkError;
+    std::filesystem::path filePath(fileName);
+    filePath.replace_filename(filePath.stem().string() + "." + std::to_string(segmentFiles.size() + 1) + filePath.extension().string());
+    PetscViewerHDF5Open(PetscObjectComm((PetscObject)viewer), filePath.string().c_str(), FILE_MODE_WRITE, &segmentViewer) >> checkError;
+    segmentFiles.push_back(filePath);
+}
@@ -0,0 +1,84 @@
+#ifndef ABLATELIBRARY_PARTICLESTATISTICS_HPP
+#define ABLATELIBRARY_PARTICLESTATISTICS_HPP
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include "monitors/viewable.hpp"
+#include "particles.hpp"
+
+namespace ablate::particles {
+
+/**
+ * Bins the particles into per cell fields on a copy of the flow dm using the stored cellid.  Each cell holds the (weighted) number of particles along with the mean and
+ * variance of each requested particle field, so the Eulerian statistics can be written in place of the particles.
+ */
+class ParticleStatistics : public monitors::Viewable {
+   private:
+    const std::shared_ptr<Particles> particles;
+    const std::vector<std::string> fields;
+    const std::string name;
+
+    // the statistics dm is a clone of the particle cell dm and is rebuilt if the cell dm changes (e.g. the flow is repartitioned)
+    mutable DM cellDM = nullptr;
+    mutable DM statisticsDM = nullptr;
+
+    // once the statistics dm is rebuilt the output is written with the new mesh to an additional file
+    mutable PetscViewer segmentViewer = nullptr;
+    mutable std::vector<std::filesystem::path> segmentFiles;
+    mutable PetscInt segmentStart = 0;
+
+    /**
+     * Opens the next additional file next to the file used by the viewer
+     * @param viewer
+     */
+    void OpenSegmentViewer(PetscViewer viewer) const;
+
+    /**
+     * Returns the number of components in a real particle field
+     * @param swarm
+     * @param field
+     * @return
+     */
+    static PetscInt GetFieldComponents(DM swarm, const std::string& field);
+
+   public:
+    /**
+     * @param particles
+     * @param fields the real particle fields to compute statistics for
+     */
+    ParticleStatistics(std::shared_ptr<Particles> particles, std::vector<std::string> fields);
+    ~ParticleStatistics();
+
+    const std::string& GetName() const override { return name; }
+
+    /**
+     * Creates the statistics dm with a count field and a mean and variance field for each particle field
+     * @param swarm
+     * @param cellDM
+     * @param name
+     * @param fields
+     * @param statisticsDM
+     */
+    static void CreateStatisticsDM(DM swarm, DM cellDM, const std::string& name, const std::vector<std::string>& fields, DM* statisticsDM);
+
+    /**
+     * Computes the statistics from the particles into a global vector on the statistics dm
+     * @param swarm
+     * @param statisticsDM
+     * @param fields
+     * @param statistics
+     */
+    static void ComputeStatistics(DM swarm, DM statisticsDM, const std::vector<std::string>& fields, Vec statistics);
+
+    /**
+     * Computes and views the statistics
+     * @param viewer
+     * @param steps
+     * @param time
+     * @param u
+     */
+    void View(PetscViewer viewer, PetscInt steps, PetscReal time, Vec u) const override;
+};
+}  // namespace ablate::particles
+#endif  // ABLATELIBRARY_PARTICLESTATISTICS_HPP
@@ -1,11 +1,17 @@
 #include "particles.hpp"
 #include <petscviewerhdf5.h>
+#include <algorithm>
+#include <numeric>
+#include "flow/fvFlow.hpp"
+#include "utilities/hilbertOrder.hpp"
+#include "utilities/mpiError.hpp"
 #include "utilities/petscError.hpp"
 #include "utilities/petscOptions.hpp"
 
 ablate::particles::Particles::Particles(std::string name, int ndims, std::shared_ptr<particles::initializers::Initializer> initializer,
                                         std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::shared_ptr<mathFunctions::MathFunction> exactSolution,
-                                        std::shared_ptr<parameters::Parameters> options)
+                                        std::shared_ptr<parameters::Parameters> options, std::shared_ptr<parameters::Parameters> parameters,
+                                        std::shared_ptr<particles::initializers::Initializer> injector)
     : ndims(ndims),
       name(name),
       timeInitial(0.0),
@@ -13,20 +19,46 @@ ablate::particles::Particles::Particles(std::string name, int ndims, std::shared
       exactSolution(exactSolution),
       petscOptions(NULL),
       dmChanged(false),
+      flowInterpolationOrder(parameters ? parameters->Get<PetscInt>("flowInterpolationOrder", 0) : 0),
+      sortFrequency(parameters ? parameters->Get<PetscInt>("sortFrequency", 0) : 0),
+      partitionWeight(parameters ? parameters->Get<PetscReal>("partitionWeight", 0.0) : 0.0),
       initializer(initializer),
-      fieldInitialization(fieldInitialization) {
+      fieldInitialization(fieldInitialization),
+      injector(injector),
+      injectionInterval(parameters ? parameters->Get<PetscInt>("injectionInterval", 0) : 0) {
     // create and associate the dm
     DMCreate(PETSC_COMM_WORLD, &dm) >> checkError;
     DMSetType(dm, DMSWARM) >> checkError;
     DMSetDimension(dm, ndims) >> checkError;
     DMSwarmSetType(dm, DMSWARM_PIC) >> checkError;
 
+    // register the particle log events
+    PetscLogEventGetId("ParticleAdvect", &advectLogEvent) >> checkError;
+    if (advectLogEvent < 0) {
+        PetscLogEventRegister("ParticleAdvect", DM_CLASSID, &advectLogEvent) >> checkError;
+    }
+    PetscLogEventGetId("ParticleInterp", &interpolateLogEvent) >> checkError;
+    if (interpolateLogEvent < 0) {
+        PetscLogEventRegister("ParticleInterp", DM_CLASSID, &interpolateLogEvent) >> checkError;
+    }
+    PetscLogEventGetId("ParticleMigrate", &migrateLogEvent) >> checkError;
+    if (migrateLogEvent < 0) {
+        PetscLogEventRegister("ParticleMigrate", DM_CLASSID, &migrateLogEvent) >> checkError;
+    }
+
     // Record the default fields
     auto positionDescriptor = particles::ParticleFieldDescriptor{.fieldName = DMSwarmPICField_coor, .components = ndims, .type = PETSC_DOUBLE};
     particleFieldDescriptors.push_back(positionDescriptor);
     particleSolutionDescriptors.push_back(positionDescriptor);
     particleFieldDescriptors.push_back(particles::ParticleFieldDescriptor{.fieldName = DMSwarmField_pid, .components = 1, .type = PETSC_INT64});
 
+    // each particle is a parcel representing ParticleWeight physical particles
+    RegisterField(ParticleFieldDescriptor{
+        .fieldName = ParticleWeight,
+        .components = 1,
+        .type = PETSC_REAL,
+    });
+
     // if the exact solution was provided, register the initial particle location in the field
     if (exactSolution) {
         // Compute the size of the exact solution (each component added up)
@@ -45,21 +77,6 @@ ablate::particles::Particles::Particles(std::string name, int ndims, std::shared
 }
 
 void ablate::particles::Particles::InitializeFlow(std::shared_ptr<flow::Flow> flow) {
-    // if more than one solution field is provided, create a new field to hold them packed together
-    if (particleSolutionDescriptors.size() > 1) {
-        auto packedSolutionComponentSize = 0;
-
-        for (const auto &solution : particleSolutionDescriptors) {
-            packedSolutionComponentSize += solution.components;
-        }
-
-        // Compute the size of the exact solution (each component added up)
-        RegisterField(ParticleFieldDescriptor{
-            .fieldName = PackedSolution,
-            .components = packedSolutionComponentSize,
-            .type = PETSC_REAL,
-        });
-    }
 
     // before setting up the flow finalize the fields
     DMSwarmFinalizeFieldRegister(dm) >> checkError;
@@ -106,6 +123,74 @@ void ablate::particles::Particles::InitializeFlow(std::shared_ptr<flow::Flow> fl
     for (auto &field : fieldInitialization) {
         this->ProjectFunction(field->GetName(), field->GetSolutionField());
     }
+
+    // if the flow is repartitioned, update the cell dm and move the particles to their new ranks
+    flow->RegisterPostRepartition([this](TS, ablate::flow::Flow &flow) { this->FlowRepartitioned(flow); });
+
+    // balance the particles along with the flow cells when repartitioning
+    if (partitionWeight > 0.0) {
+        if (auto fvFlow = std::dynamic_pointer_cast<ablate::flow::FVFlow>(flow)) {
+            fvFlow->RegisterComputeCellWeightFunction(ComputeParticleCellWeight, this);
+        } else {
+            throw std::invalid_argument("The particle partitionWeight can only be used with ablate::flow::FVFlow");
+        }
+    }
+}
+
+PetscReal ablate::particles::Particles::ComputeParticleCellWeight(ablate::flow::Flow &flow, PetscInt cell, void *ctx) {
+    auto particles = (ablate::particles::Particles *)ctx;
+
+    // count the particles in each cell once for all of the cells
+    if (!particles->cellParticleCountValid) {
+        PetscInt cStart, cEnd;
+        DMPlexGetHeightStratum(flow.GetDM(), 0, &cStart, &cEnd) >> checkError;
+        particles->cellParticleCountStart = cStart;
+        particles->cellParticleCount.assign(cEnd - cStart, 0);
+
+        PetscInt np;
+        DMSwarmGetLocalSize(particles->dm, &np) >> checkError;
+        PetscInt *cellid;
+        DMSwarmGetField(particles->dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellid) >> checkError;
+        for (PetscInt p = 0; p < np; ++p) {
+            if (cellid[p] >= cStart && cellid[p] < cEnd) {
+                particles->cellParticleCount[cellid[p] - cStart]++;
+            }
+        }
+        DMSwarmRestoreField(particles->dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellid) >> checkError;
+        particles->cellParticleCountValid = true;
+    }
+
+    const PetscInt index = cell - particles->cellParticleCountStart;
+    if (index >= 0 && index < (PetscInt)particles->cellParticleCount.size()) {
+        return particles->partitionWeight * particles->cellParticleCount[index];
+    }
+    return 0.0;
+}
+
+void ablate::particles::Particles::FlowRepartitioned(ablate::flow::Flow &flow) {
+    DMSwarmSetCellDM(dm, flow.GetDM()) >> checkError;
+
+    // this is called before the flow step, so the initial and final flow are the same
+    flowFinal = flow.GetSolutionVector();
+    VecDestroy(&flowInitial) >> checkError;
+    VecDuplicate(flowFinal, &flowInitial) >> checkError;
+    VecCopy(flowFinal, flowInitial) >> checkError;
+
+    // the velocity sub dm and the injected particle locations must be rebuilt from the new flow dm
+    DestroyFlowVelocityDM();
+    injectionValid = false;
+    cellOrderDM = nullptr;
+    cellOrder.clear();
+
+    // the stored cells are numbered for the old dm, so search for each particle instead of walking from an unrelated cell
+    PetscInt np;
+    DMSwarmGetLocalSize(dm, &np) >> checkError;
+    PetscInt *cellid;
+    DMSwarmGetField(dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellid) >> checkError;
+    std::fill(cellid, cellid + np, -1);
+    DMSwarmRestoreField(dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellid) >> checkError;
+
+    SwarmMigrate();
 }
 
 ablate::particles::Particles::~Particles() {
@@ -118,6 +203,12 @@ ablate::particles::Particles::~Particles() {
     if (flowInitial) {
         VecDestroy(&flowInitial) >> checkError;
     }
+    if (solutionBuffer) {
+        VecDestroy(&solutionBuffer) >> checkError;
+        VecDestroy(&absoluteTolerance) >> checkError;
+        VecDestroy(&relativeTolerance) >> checkError;
+    }
+    DestroyFlowVelocityDM();
     if (petscOptions) {
         ablate::utilities::PetscOptionsDestroyAndCheck(name, &petscOptions);
     }
@@ -197,6 +288,11 @@ PetscErrorCode ablate::particles::Particles::ComputeParticleExactSolution(TS par
         // Call the update function
         functionPointer(dim, time, initialParticleLocationArray + initialPositionOffset, solutionFieldSize, exactSolutionArray + fieldOffset, functionContext) >> checkError;
     }
+
+    // zero any padding past the active particles
+    PetscInt exactSolutionSize;
+    VecGetLocalSize(exactSolution, &exactSolutionSize) >> checkError;
+    PetscArrayzero(exactSolutionArray + np * solutionFieldSize, exactSolutionSize - np * solutionFieldSize) >> checkError;
     VecRestoreArrayWrite(exactSolution, &exactSolutionArray) >> checkError;
 
     // cleanup
@@ -220,6 +316,7 @@ PetscErrorCode ablate::particles::Particles::ComputeParticleError(TS particleTS,
     // Create a vector of the current solution
     Vec exactSolutionVec;
     VecDuplicate(u, &exactSolutionVec) >> checkError;
+    VecZeroEntries(exactSolutionVec) >> checkError;
     PetscScalar *exactSolutionArray;
     VecGetArrayWrite(exactSolutionVec, &exactSolutionArray) >> checkError;
 
@@ -266,20 +363,25 @@ PetscErrorCode ablate::particles::Particles::ComputeParticleError(TS particleTS,
     VecRestoreArrayWrite(exactSolutionVec, &exactSolutionArray) >> checkError;
     VecRestoreArrayWrite(exactLocationVec, &exactLocationArray) >> checkError;
 
-    // Get all points still in this mesh
+    // Get all points still in this mesh, starting the search from the current cell of each particle
     DM flowDM;
     VecGetDM(particles->flowFinal, &flowDM) >> checkError;
-    PetscSF cellSF = NULL;
-    DMLocatePoints(flowDM, exactLocationVec, DM_POINTLOCATION_NONE, &cellSF) >> checkError;
-    const PetscSFNode *cells;
-    PetscSFGetGraph(cellSF, NULL, NULL, NULL, &cells) >> checkError;
+    std::vector<PetscInt> cells(np);
+    PetscInt *cellIds;
+    DMSwarmGetField(particles->dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellIds) >> checkError;
+    std::copy(cellIds, cellIds + np, cells.begin());
+    DMSwarmRestoreField(particles->dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellIds) >> checkError;
+    const PetscScalar *exactLocationReadArray;
+    VecGetArrayRead(exactLocationVec, &exactLocationReadArray) >> checkError;
+    LocateCells(flowDM, np, (const PetscReal *)exactLocationReadArray, cells.data());
+    VecRestoreArrayRead(exactLocationVec, &exactLocationReadArray) >> checkError;
 
     // compute the difference between exact and u
     VecWAXPY(errorVec, -1, exactSolutionVec, u);
 
     // zero out the error if any particle moves outside of the domain
     for (PetscInt p = 0; p < np; ++p) {
-        if (cells[p].index == DMLOCATEPOINT_POINT_NOT_FOUND) {
+        if (cells[p] == DMLOCATEPOINT_POINT_NOT_FOUND) {
             for (PetscInt c = 0; c < solutionFieldSize; ++c) {
                 VecSetValue(errorVec, p * solutionFieldSize + c, 0.0, INSERT_VALUES) >> checkError;
             }
@@ -288,9 +390,6 @@ PetscErrorCode ablate::particles::Particles::ComputeParticleError(TS particleTS,
     VecAssemblyBegin(errorVec) >> checkError;
     VecAssemblyEnd(errorVec) >> checkError;
 
-    // restore all of the vecs/fields
-    PetscSFDestroy(&cellSF) >> checkError;
-
     // cleanup
     DMSwarmRestoreField(particles->dm, ParticleInitialLocation, NULL, NULL, (void **)&initialParticleLocationArray) >> checkError;
     VecDestroy(&exactSolutionVec) >> checkError;
@@ -300,32 +399,478 @@ PetscErrorCode ablate::particles::Particles::ComputeParticleError(TS particleTS,
 }
 
 void ablate::particles::Particles::SwarmMigrate() {
-    // current number of local/global particles
-    PetscInt numberLocal;
-    PetscInt numberGlobal;
+    // update the cell of each particle starting from the previously stored cell.  The swarm only needs to be migrated if a particle left the local domain
+    DM cellDM;
+    DMSwarmGetCellDM(dm, &cellDM) >> checkError;
+    PetscInt leftLocalDomain = UpdateCellIds(cellDM) ? PETSC_TRUE : PETSC_FALSE;
+    cellParticleCountValid = false;
+    MPI_Comm comm;
+    PetscObjectGetComm((PetscObject)particleTs, &comm) >> checkError;
+    PetscInt leftLocalDomainAll = PETSC_FALSE;
+    MPIU_Allreduce(&leftLocalDomain, &leftLocalDomainAll, 1, MPIU_INT, MPIU_MAX, comm);
+    if (!leftLocalDomainAll) {
+        return;
+    }
 
-    // Get the current size
+    // current number of local particles.  The global size is not checked because DMSwarmGetSize is a separate global reduction and any change in the
+    // global size must also change the local size on at least one rank
+    PetscInt numberLocal;
     DMSwarmGetLocalSize(dm, &numberLocal) >> checkError;
-    DMSwarmGetSize(dm, &numberGlobal) >> checkError;
 
     // Migrate any particles that have moved
-    DMSwarmMigrate(dm, PETSC_TRUE) >> checkError;
+    PetscLogEventBegin(migrateLogEvent, dm, 0, 0, 0) >> checkError;
+    PetscErrorCode migrateError = DMSwarmMigrate(dm, PETSC_TRUE);
+    PetscLogEventEnd(migrateLogEvent, dm, 0, 0, 0) >> checkError;
+    migrateError >> checkError;
 
-    // get the new sizes
-    PetscInt newNumberLocal;
-    PetscInt newNumberGlobal;
+    // the received particles store the cell from the sending rank
+    UpdateCellIds(cellDM);
 
     // Get the updated size
+    PetscInt newNumberLocal;
     DMSwarmGetLocalSize(dm, &newNumberLocal) >> checkError;
-    DMSwarmGetSize(dm, &newNumberGlobal) >> checkError;
 
-    // Check to see if any of the ranks changed size after migration
-    PetscInt dmChanged = newNumberGlobal != numberGlobal || newNumberLocal != numberLocal;
+    // Check to see if any of the ranks changed size after migration and, in the same reduction, if any rank needs a larger solution buffer
+    PetscInt changed[2] = {newNumberLocal != numberLocal, SolutionBufferTooSmall()};
+    PetscInt changedAll[2] = {PETSC_FALSE, PETSC_FALSE};
+    MPIU_Allreduce(changed, changedAll, 2, MPIU_INT, MPIU_MAX, comm);
+
+    // the local particles no longer match the interpolation
+    if (changedAll[0]) {
+        this->dmChanged = true;
+        solutionBufferGrowKnown = true;
+        solutionBufferGrow = changedAll[1];
+        ResetFlowVelocityInterpolation();
+    }
+}
+
+bool ablate::particles::Particles::SolutionBufferTooSmall() const {
+    PetscInt np;
+    DMSwarmGetLocalSize(dm, &np) >> checkError;
+    return solutionBuffer == nullptr || np > particleCapacity;
+}
+
+void ablate::particles::Particles::UpdateSolutionBuffer() {
+    PetscInt np;
+    DMSwarmGetLocalSize(dm, &np) >> checkError;
+    PetscInt solutionComponents = 0;
+    for (const auto &field : particleSolutionDescriptors) {
+        solutionComponents += field.components;
+    }
+
+    // the buffer is only rebuilt (and the ts reset) if any rank has more particles than it can hold.  This is already known if the swarm only changed by migration
     MPI_Comm comm;
     PetscObjectGetComm((PetscObject)particleTs, &comm) >> checkError;
-    PetscInt dmChangedAll = PETSC_FALSE;
-    MPIU_Allreduce(&dmChanged, &dmChangedAll, 1, MPIU_INT, MPIU_MAX, comm);
-    this->dmChanged = dmChangedAll == PETSC_TRUE;
+    PetscInt growAll = solutionBufferGrow;
+    if (!solutionBufferGrowKnown) {
+        PetscInt grow = SolutionBufferTooSmall();
+        MPIU_Allreduce(&grow, &growAll, 1, MPIU_INT, MPIU_MAX, comm);
+    }
+    solutionBufferGrowKnown = false;
+
+    if (growAll) {
+        // leave some headroom so that a slowly increasing number of particles does not reset the ts every step
+        particleCapacity = PetscMax(particleCapacity, np + np / 4);
+
+        if (solutionBuffer) {
+            VecDestroy(&solutionBuffer) >> checkError;
+            VecDestroy(&absoluteTolerance) >> checkError;
+            VecDestroy(&relativeTolerance) >> checkError;
+        }
+        VecCreateMPI(comm, particleCapacity * solutionComponents, PETSC_DETERMINE, &solutionBuffer) >> checkError;
+        VecSetBlockSize(solutionBuffer, solutionComponents) >> checkError;
+        VecDuplicate(solutionBuffer, &absoluteTolerance) >> checkError;
+        VecDuplicate(solutionBuffer, &relativeTolerance) >> checkError;
+        TSReset(particleTs) >> checkError;
+    }
+
+    // only the active particles contribute to the error used by the time step adaptor
+    PetscReal atol, rtol;
+    TSGetTolerances(particleTs, &atol, NULL, &rtol, NULL) >> checkError;
+    PetscScalar *absoluteToleranceArray, *relativeToleranceArray;
+    VecGetArrayWrite(absoluteTolerance, &absoluteToleranceArray) >> checkError;
+    VecGetArrayWrite(relativeTolerance, &relativeToleranceArray) >> checkError;
+    for (PetscInt i = 0; i < particleCapacity * solutionComponents; ++i) {
+        absoluteToleranceArray[i] = i < np * solutionComponents ? atol : 0.0;
+        relativeToleranceArray[i] = i < np * solutionComponents ? rtol : 0.0;
+    }
+    VecRestoreArrayWrite(absoluteTolerance, &absoluteToleranceArray) >> checkError;
+    VecRestoreArrayWrite(relativeTolerance, &relativeToleranceArray) >> checkError;
+    TSSetTolerances(particleTs, atol, absoluteTolerance, rtol, relativeTolerance) >> checkError;
+}
+
+void ablate::particles::Particles::SortParticles() {
+    PetscInt np;
+    DMSwarmGetLocalSize(dm, &np) >> checkError;
+    DM cellDM;
+    DMSwarmGetCellDM(dm, &cellDM) >> checkError;
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(cellDM, 0, &cStart, &cEnd) >> checkError;
+
+    // the position of each cell along the Hilbert curve only depends on the cell dm, so it is computed once for each flow partition
+    if (cellOrderDM != cellDM || (PetscInt)cellOrder.size() != cEnd - cStart) {
+        cellOrder = utilities::HilbertOrder::ComputeCellOrder(cellDM, cStart, cEnd);
+        cellOrderDM = cellDM;
+    }
+
+    // bucket the particles by the ordered cell, keeping the current order within each cell
+    std::vector<PetscInt> offsets(cEnd - cStart + 1, 0);
+    PetscInt *cellIds;
+    DMSwarmGetField(dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellIds) >> checkError;
+    bool validCells = true;
+    for (PetscInt p = 0; p < np; ++p) {
+        if (cellIds[p] < cStart || cellIds[p] >= cEnd) {
+            validCells = false;
+            break;
+        }
+        offsets[cellOrder[cellIds[p] - cStart] + 1]++;
+    }
+    std::vector<PetscInt> permutation(np);
+    if (validCells) {
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        for (PetscInt p = 0; p < np; ++p) {
+            permutation[offsets[cellOrder[cellIds[p] - cStart]]++] = p;
+        }
+    }
+    DMSwarmRestoreField(dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellIds) >> checkError;
+
+    // the cell ids are updated after every migration, so this should only happen if a particle was not located
+    if (!validCells) {
+        return;
+    }
+
+    // reorder every field stored in the swarm
+    std::vector<std::string> fieldNames = {DMSwarmPICField_cellid, DMSwarmField_rank};
+    for (const auto &field : particleFieldDescriptors) {
+        fieldNames.push_back(field.fieldName);
+    }
+    std::vector<char> buffer;
+    for (const auto &fieldName : fieldNames) {
+        PetscInt blockSize;
+        PetscDataType dataType;
+        char *fieldData;
+        DMSwarmGetField(dm, fieldName.c_str(), &blockSize, &dataType, (void **)&fieldData) >> checkError;
+        size_t typeSize;
+        PetscDataTypeGetSize(dataType, &typeSize) >> checkError;
+        const size_t particleSize = typeSize * blockSize;
+
+        buffer.resize(np * particleSize);
+        for (PetscInt p = 0; p < np; ++p) {
+            std::copy(fieldData + permutation[p] * particleSize, fieldData + (permutation[p] + 1) * particleSize, buffer.begin() + p * particleSize);
+        }
+        std::copy(buffer.begin(), buffer.end(), fieldData);
+        DMSwarmRestoreField(dm, fieldName.c_str(), NULL, NULL, (void **)&fieldData) >> checkError;
+    }
+
+    // the number of local particles is unchanged, so only the interpolation must be rebuilt with the new order
+    ResetFlowVelocityInterpolation();
+}
+
+bool ablate::particles::Particles::UpdateCellIds(DM cellDM) {
+    PetscInt np;
+    DMSwarmGetLocalSize(dm, &np) >> checkError;
+    const PetscReal *coordinates;
+    PetscInt *cellIds;
+    DMSwarmGetField(dm, DMSwarmPICField_coor, NULL, NULL, (void **)&coordinates) >> checkError;
+    DMSwarmGetField(dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellIds) >> checkError;
+
+    LocateCells(cellDM, np, coordinates, cellIds);
+
+    bool leftLocalDomain = false;
+    for (PetscInt p = 0; p < np; ++p) {
+        if (cellIds[p] == DMLOCATEPOINT_POINT_NOT_FOUND) {
+            leftLocalDomain = true;
+            break;
+        }
+    }
+
+    DMSwarmRestoreField(dm, DMSwarmPICField_coor, NULL, NULL, (void **)&coordinates) >> checkError;
+    DMSwarmRestoreField(dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellIds) >> checkError;
+    return leftLocalDomain;
+}
+
+void ablate::particles::Particles::LocateCells(DM cellDM, PetscInt np, const PetscReal *coordinates, PetscInt *cells) {
+    PetscInt dim;
+    DMGetDimension(cellDM, &dim) >> checkError;
+
+    // only walk through the interior cells
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(cellDM, 0, &cStart, &cEnd) >> checkError;
+    PetscInt ghostStart;
+    DMPlexGetGhostCellStratum(cellDM, &ghostStart, NULL) >> checkError;
+    if (ghostStart >= 0) {
+        cEnd = ghostStart;
+    }
+
+    // the face normals/centroids are used to determine which face (if any) the point is outside of
+    Vec faceGeomVec;
+    DMPlexGetGeometryFVM(cellDM, &faceGeomVec, NULL, NULL) >> checkError;
+    DM faceDM;
+    VecGetDM(faceGeomVec, &faceDM) >> checkError;
+    const PetscScalar *faceGeomArray;
+    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+
+    // the points that could not be found by walking
+    std::vector<PetscInt> lostPoints;
+
+    for (PetscInt p = 0; p < np; ++p) {
+        const PetscReal *point = coordinates + p * dim;
+        PetscInt cell = cells[p] >= cStart && cells[p] < cEnd ? cells[p] : -1;
+        bool found = false;
+
+        for (PetscInt step = 0; cell >= 0 && step < maxCellWalk; ++step) {
+            // find the face the point is furthest outside of
+            PetscInt numberFaces;
+            const PetscInt *faces;
+            DMPlexGetConeSize(cellDM, cell, &numberFaces) >> checkError;
+            DMPlexGetCone(cellDM, cell, &faces) >> checkError;
+
+            PetscReal maxDistance = 0.0;
+            PetscInt exitFace = -1;
+            for (PetscInt f = 0; f < numberFaces; ++f) {
+                const PetscFVFaceGeom *faceGeom;
+                DMPlexPointLocalRead(faceDM, faces[f], faceGeomArray, &faceGeom) >> checkError;
+                const PetscInt *support;
+                DMPlexGetSupport(cellDM, faces[f], &support) >> checkError;
+
+                PetscReal distance = 0.0;
+                PetscReal area = 0.0;
+                for (PetscInt d = 0; d < dim; ++d) {
+                    distance += (point[d] - faceGeom->centroid[d]) * faceGeom->normal[d];
+                    area += PetscSqr(faceGeom->normal[d]);
+                }
+
+                // the face normal points from support[0] to support[1]
+                distance /= PetscSqrtReal(area);
+                if (support[0] != cell) {
+                    distance = -distance;
+                }
+                if (distance > maxDistance) {
+                    maxDistance = distance;
+                    exitFace = faces[f];
+                }
+            }
+
+            // the point is inside of every face
+            if (exitFace < 0) {
+                found = true;
+                break;
+            }
+
+            // move to the neighbor across the exit face, stop if it is a boundary or ghost cell
+            PetscInt supportSize;
+            const PetscInt *support;
+            DMPlexGetSupportSize(cellDM, exitFace, &supportSize) >> checkError;
+            DMPlexGetSupport(cellDM, exitFace, &support) >> checkError;
+            PetscInt neighbor = supportSize == 2 ? (support[0] == cell ? support[1] : support[0]) : -1;
+            cell = neighbor >= cStart && neighbor < cEnd ? neighbor : -1;
+        }
+
+        if (found) {
+            cells[p] = cell;
+        } else {
+            cells[p] = DMLOCATEPOINT_POINT_NOT_FOUND;
+            lostPoints.push_back(p);
+        }
+    }
+    VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+
+    // search the local domain for any point that walked out of it
+    if (!lostPoints.empty()) {
+        const PetscInt numberLost = lostPoints.size();
+        Vec lostPointVec;
+        VecCreateSeq(PETSC_COMM_SELF, numberLost * dim, &lostPointVec) >> checkError;
+        VecSetBlockSize(lostPointVec, dim) >> checkError;
+        PetscScalar *lostPointArray;
+        VecGetArray(lostPointVec, &lostPointArray) >> checkError;
+        for (PetscInt l = 0; l < numberLost; ++l) {
+            for (PetscInt d = 0; d < dim; ++d) {
+                lostPointArray[l * dim + d] = coordinates[lostPoints[l] * dim + d];
+            }
+        }
+        VecRestoreArray(lostPointVec, &lostPointArray) >> checkError;
+
+        PetscSF cellSF = NULL;
+        DMLocatePoints(cellDM, lostPointVec, DM_POINTLOCATION_NONE, &cellSF) >> checkError;
+        const PetscSFNode *locatedCells;
+        PetscSFGetGraph(cellSF, NULL, NULL, NULL, &locatedCells) >> checkError;
+        for (PetscInt l = 0; l < numberLost; ++l) {
+            cells[lostPoints[l]] = locatedCells[l].index;
+        }
+
+        PetscSFDestroy(&cellSF) >> checkError;
+        VecDestroy(&lostPointVec) >> checkError;
+    }
+}
+
+static PetscErrorCode GetLocalVelocity(DM velocityDM, IS velocityIS, Vec flow, PetscReal time, Vec localVelocity) {
+    PetscFunctionBeginUser;
+    PetscErrorCode ierr;
+    Vec vel;
+    ierr = VecGetSubVector(flow, velocityIS, &vel);
+    CHKERRQ(ierr);
+    ierr = DMPlexInsertBoundaryValues(velocityDM, PETSC_TRUE, localVelocity, time, NULL, NULL, NULL);
+    CHKERRQ(ierr);
+    ierr = DMGlobalToLocalBegin(velocityDM, vel, INSERT_VALUES, localVelocity);
+    CHKERRQ(ierr);
+    ierr = DMGlobalToLocalEnd(velocityDM, vel, INSERT_VALUES, localVelocity);
+    CHKERRQ(ierr);
+    ierr = VecRestoreSubVector(flow, velocityIS, &vel);
+    CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::particles::Particles::UpdateLocalFlowVelocity() {
+    PetscFunctionBeginUser;
+    PetscErrorCode ierr;
+
+    // the velocity sub dm is only created once per flow dm
+    if (!velocityDM) {
+        DM cellDM;
+        ierr = DMSwarmGetCellDM(dm, &cellDM);
+        CHKERRQ(ierr);
+        PetscInt vf[1] = {flowVelocityFieldIndex};
+        ierr = DMCreateSubDM(cellDM, 1, vf, &velocityIS, &velocityDM);
+        CHKERRQ(ierr);
+    }
+    if (!localVelocityFinal) {
+        ierr = DMCreateLocalVector(velocityDM, &localVelocityFinal);
+        CHKERRQ(ierr);
+        ierr = VecDuplicate(localVelocityFinal, &localVelocityInitial);
+        CHKERRQ(ierr);
+        ierr = VecDuplicate(localVelocityFinal, &localVelocityPrevious);
+        CHKERRQ(ierr);
+        ierr = VecDuplicate(localVelocityFinal, &localVelocityStage);
+        CHKERRQ(ierr);
+    }
+
+    // the end of step flow uses the boundary values at the start of the step when it is the only snapshot used
+    ierr = GetLocalVelocity(velocityDM, velocityIS, flowFinal, flowInterpolationOrder > 0 ? timeFinal : timeInitial, localVelocityFinal);
+    CHKERRQ(ierr);
+    if (flowInterpolationOrder > 0) {
+        ierr = GetLocalVelocity(velocityDM, velocityIS, flowInitial, timeInitial, localVelocityInitial);
+        CHKERRQ(ierr);
+    }
+    localVelocityValid = true;
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::particles::Particles::InterpolateFlowVelocity(PetscReal time, PetscInt np, const PetscReal *coordinates, Vec velocity) {
+    PetscFunctionBeginUser;
+    PetscErrorCode ierr;
+
+    DM cellDM;
+    ierr = DMSwarmGetCellDM(dm, &cellDM);
+    CHKERRQ(ierr);
+    PetscInt dim;
+    ierr = DMGetDimension(cellDM, &dim);
+    CHKERRQ(ierr);
+
+    // the local flow velocity snapshots are only updated once per particle solve
+    if (!localVelocityValid) {
+        ierr = UpdateLocalFlowVelocity();
+        CHKERRQ(ierr);
+    }
+
+    // interpolate the flow velocity in time.  Because the spatial interpolation is linear in the field values, the snapshots are combined before a single evaluation
+    Vec locvel = localVelocityFinal;
+    if (flowInterpolationOrder > 0 && timeFinal > timeInitial) {
+        ierr = VecCopy(localVelocityFinal, localVelocityStage);
+        CHKERRQ(ierr);
+        if (flowInterpolationOrder > 1 && previousVelocityValid) {
+            // quadratic Lagrange interpolation through the previous, initial, and final snapshots
+            const PetscReal tp = timePrevious, ti = timeInitial, tf = timeFinal;
+            const PetscReal wp = (time - ti) * (time - tf) / ((tp - ti) * (tp - tf));
+            const PetscReal wi = (time - tp) * (time - tf) / ((ti - tp) * (ti - tf));
+            const PetscReal wf = (time - tp) * (time - ti) / ((tf - tp) * (tf - ti));
+            ierr = VecAXPBYPCZ(localVelocityStage, wi, wp, wf, localVelocityInitial, localVelocityPrevious);
+            CHKERRQ(ierr);
+        } else {
+            const PetscReal theta = (time - timeInitial) / (timeFinal - timeInitial);
+            ierr = VecAXPBY(localVelocityStage, 1.0 - theta, theta, localVelocityInitial);
+            CHKERRQ(ierr);
+        }
+        locvel = localVelocityStage;
+    }
+
+    ierr = PetscLogEventBegin(interpolateLogEvent, dm, 0, 0, 0);
+    CHKERRQ(ierr);
+
+    // update the existing interpolation in place, walking each particle from its previous cell
+    PetscBool rebuild = velocityInterpolation == nullptr || velocityInterpolation->n != np ? PETSC_TRUE : PETSC_FALSE;
+    if (!rebuild) {
+        PetscScalar *points;
+        ierr = VecGetArray(velocityInterpolation->coords, &points);
+        CHKERRQ(ierr);
+        ierr = PetscArraycpy(points, coordinates, np * dim);
+        CHKERRQ(ierr);
+        ierr = VecRestoreArray(velocityInterpolation->coords, &points);
+        CHKERRQ(ierr);
+
+        LocateCells(velocityDM, np, coordinates, velocityInterpolation->cells);
+
+        // any particle that has left the local domain requires the full setup
+        for (PetscInt p = 0; p < np; ++p) {
+            if (velocityInterpolation->cells[p] == DMLOCATEPOINT_POINT_NOT_FOUND) {
+                rebuild = PETSC_TRUE;
+                break;
+            }
+        }
+    }
+
+    if (rebuild) {
+        if (velocityInterpolation) {
+            ierr = DMInterpolationDestroy(&velocityInterpolation);
+            CHKERRQ(ierr);
+        }
+
+        ierr = DMInterpolationCreate(PETSC_COMM_SELF, &velocityInterpolation);
+        CHKERRQ(ierr);
+        ierr = DMInterpolationSetDim(velocityInterpolation, dim);
+        CHKERRQ(ierr);
+        ierr = DMInterpolationSetDof(velocityInterpolation, dim);
+        CHKERRQ(ierr);
+        ierr = DMInterpolationAddPoints(velocityInterpolation, np, (PetscReal *)coordinates);
+        CHKERRQ(ierr);
+
+        /* Particles that lie outside the domain should be dropped,
+         whereas particles that move to another partition should trigger a migration */
+        ierr = DMInterpolationSetUp(velocityInterpolation, velocityDM, PETSC_FALSE, PETSC_TRUE);
+        CHKERRQ(ierr);
+    }
+
+    ierr = VecSet(velocity, 0.);
+    CHKERRQ(ierr);
+    ierr = DMInterpolationEvaluate(velocityInterpolation, velocityDM, locvel, velocity);
+    CHKERRQ(ierr);
+    ierr = PetscLogEventEnd(interpolateLogEvent, dm, 0, 0, 0);
+    CHKERRQ(ierr);
+
+    PetscFunctionReturn(0);
+}
+
+void ablate::particles::Particles::ResetFlowVelocityInterpolation() {
+    if (velocityInterpolation) {
+        DMInterpolationDestroy(&velocityInterpolation) >> checkError;
+    }
+}
+
+void ablate::particles::Particles::DestroyFlowVelocityDM() {
+    ResetFlowVelocityInterpolation();
+    if (localVelocityFinal) {
+        VecDestroy(&localVelocityFinal) >> checkError;
+        VecDestroy(&localVelocityInitial) >> checkError;
+        VecDestroy(&localVelocityPrevious) >> checkError;
+        VecDestroy(&localVelocityStage) >> checkError;
+    }
+    if (velocityDM) {
+        DMDestroy(&velocityDM) >> checkError;
+    }
+    if (velocityIS) {
+        ISDestroy(&velocityIS) >> checkError;
+    }
+    localVelocityValid = false;
+    previousVelocityValid = false;
 }
 
 /**
@@ -333,7 +878,7 @@ void ablate::particles::Particles::SwarmMigrate() {
  * @param field
  * @param mathFunction
  */
-void ablate::particles::Particles::ProjectFunction(const std::string &field, ablate::mathFunctions::MathFunction &mathFunction) {
+void ablate::particles::Particles::ProjectFunction(const std::string &field, ablate::mathFunctions::MathFunction &mathFunction, PetscInt start) {
     // Get the local number of particles
     PetscInt np;
     DMSwarmGetLocalSize(dm, &np) >> checkError;
@@ -357,7 +902,7 @@ void ablate::particles::Particles::ProjectFunction(const std::string &field, abl
     ablate::mathFunctions::PetscFunction functionPointer = mathFunction.GetPetscFunction();
 
     // Iterate over each local particle
-    for (PetscInt p = 0; p < np; ++p) {
+    for (PetscInt p = start; p < np; ++p) {
         // compute the position offset
         const PetscInt positionOffset = p * dim;
 
@@ -371,132 +916,303 @@ void ablate::particles::Particles::ProjectFunction(const std::string &field, abl
     DMSwarmRestoreField(dm, field.c_str(), NULL, NULL, (void **)&fieldData);
 }
 
-Vec ablate::particles::Particles::GetPackedSolutionVector() {
-    const PetscInt nf = particleSolutionDescriptors.size();
+PetscReal ablate::particles::Particles::ComputeTotalWeight(DM dm) {
+    PetscInt np;
+    DMSwarmGetLocalSize(dm, &np) >> checkError;
 
-    // If there is more than one field, pack up the data
-    if (nf > 1) {
-        // Get the local number of particles
-        PetscInt np;
-        DMSwarmGetLocalSize(dm, &np) >> checkError;
+    PetscReal *weight;
+    DMSwarmGetField(dm, ParticleWeight, NULL, NULL, (void **)&weight) >> checkError;
+    PetscReal localWeight = 0.0;
+    for (PetscInt p = 0; p < np; ++p) {
+        localWeight += weight[p];
+    }
+    DMSwarmRestoreField(dm, ParticleWeight, NULL, NULL, (void **)&weight) >> checkError;
 
-        // Get a vector of pointers to the solution fields
-        std::vector<PetscReal *> fieldDatas(nf);
-        std::vector<PetscInt> fieldSizes(nf);
+    PetscReal totalWeight = 0.0;
+    MPIU_Allreduce(&localWeight, &totalWeight, 1, MPIU_REAL, MPIU_SUM, PetscObjectComm((PetscObject)dm));
+    return totalWeight;
+}
 
-        // get raw access to each array
-        for (auto f = 0; f < nf; f++) {
-            DMSwarmGetField(dm, particleSolutionDescriptors[f].fieldName.c_str(), &fieldSizes[f], NULL, (void **)&fieldDatas[f]) >> checkError;
+std::vector<PetscReal> ablate::particles::Particles::ComputeWeightedMean(DM dm, const std::string &field) {
+    PetscInt np;
+    DMSwarmGetLocalSize(dm, &np) >> checkError;
+
+    PetscInt fieldComponents;
+    PetscDataType fieldType;
+    PetscReal *fieldData;
+    DMSwarmGetField(dm, field.c_str(), &fieldComponents, &fieldType, (void **)&fieldData) >> checkError;
+    if (fieldType != PETSC_REAL) {
+        DMSwarmRestoreField(dm, field.c_str(), NULL, NULL, (void **)&fieldData) >> checkError;
+        throw std::invalid_argument("ComputeWeightedMean only supports PETSC_REAL");
+    }
+    PetscReal *weight;
+    DMSwarmGetField(dm, ParticleWeight, NULL, NULL, (void **)&weight) >> checkError;
+
+    // sum the weighted field with the total weight in the last component
+    std::vector<PetscReal> localSum(fieldComponents + 1, 0.0);
+    for (PetscInt p = 0; p < np; ++p) {
+        for (PetscInt c = 0; c < fieldComponents; ++c) {
+            localSum[c] += weight[p] * fieldData[p * fieldComponents + c];
+        }
+        localSum[fieldComponents] += weight[p];
+    }
+    DMSwarmRestoreField(dm, ParticleWeight, NULL, NULL, (void **)&weight) >> checkError;
+    DMSwarmRestoreField(dm, field.c_str(), NULL, NULL, (void **)&fieldData) >> checkError;
+
+    std::vector<PetscReal> sum(fieldComponents + 1, 0.0);
+    MPIU_Allreduce(localSum.data(), sum.data(), fieldComponents + 1, MPIU_REAL, MPIU_SUM, PetscObjectComm((PetscObject)dm));
+
+    std::vector<PetscReal> mean(fieldComponents, 0.0);
+    if (sum[fieldComponents] > 0.0) {
+        for (PetscInt c = 0; c < fieldComponents; ++c) {
+            mean[c] = sum[c] / sum[fieldComponents];
         }
+    }
+    return mean;
+}
 
-        // and raw access to the combined array
-        PetscInt solutionComponents;
-        PetscReal *solutionFieldData;
-        DMSwarmGetField(dm, PackedSolution, &solutionComponents, NULL, (void **)&solutionFieldData) >> checkError;
+void ablate::particles::Particles::PackSolution(Vec solution) {
+    const PetscInt nf = particleSolutionDescriptors.size();
 
+    // Get the local number of particles
+    PetscInt np;
+    DMSwarmGetLocalSize(dm, &np) >> checkError;
+
+    // Get a vector of pointers to the solution fields
+    std::vector<const PetscReal *> fieldDatas(nf);
+    std::vector<PetscInt> fieldSizes(nf);
+    PetscInt solutionComponents = 0;
+    for (auto f = 0; f < nf; f++) {
+        DMSwarmGetField(dm, particleSolutionDescriptors[f].fieldName.c_str(), &fieldSizes[f], NULL, (void **)&fieldDatas[f]) >> checkError;
+        solutionComponents += fieldSizes[f];
+    }
+
+    // copy each field directly into the (padded) solution
+    PetscInt solutionSize;
+    VecGetLocalSize(solution, &solutionSize) >> checkError;
+    PetscScalar *solutionData;
+    VecGetArrayWrite(solution, &solutionData) >> checkError;
+    if (nf == 1) {
+        PetscArraycpy(solutionData, fieldDatas[0], np * solutionComponents) >> checkError;
+    } else {
         for (PetscInt p = 0; p < np; ++p) {
             PetscInt offset = 0;
             // March over each field
             for (PetscInt f = 0; f < nf; ++f) {
                 for (PetscInt c = 0; c < fieldSizes[f]; c++) {
-                    solutionFieldData[p * solutionComponents + offset++] = fieldDatas[f][p * fieldSizes[f] + c];
+                    solutionData[p * solutionComponents + offset++] = fieldDatas[f][p * fieldSizes[f] + c];
                 }
             }
         }
-
-        // return raw access
-        for (auto f = 0; f < nf; f++) {
-            DMSwarmRestoreField(dm, particleSolutionDescriptors[f].fieldName.c_str(), NULL, NULL, (void **)&fieldDatas[f]) >> checkError;
-        }
-        DMSwarmRestoreField(dm, PackedSolution, NULL, NULL, (void **)&solutionFieldData) >> checkError;
     }
+    PetscArrayzero(solutionData + np * solutionComponents, solutionSize - np * solutionComponents) >> checkError;
+    VecRestoreArrayWrite(solution, &solutionData) >> checkError;
 
-    // get the updated values as a vec
-    Vec packedVector;
-    DMSwarmCreateGlobalVectorFromField(dm, GetSolutionVectorName(), &packedVector) >> checkError;
-    return packedVector;
+    // return raw access
+    for (auto f = 0; f < nf; f++) {
+        DMSwarmRestoreField(dm, particleSolutionDescriptors[f].fieldName.c_str(), NULL, NULL, (void **)&fieldDatas[f]) >> checkError;
+    }
 }
 
-void ablate::particles::Particles::RestorePackedSolutionVector(Vec solutionVector) {
+void ablate::particles::Particles::UnpackSolution(Vec solution) {
     const PetscInt nf = particleSolutionDescriptors.size();
 
-    DMSwarmDestroyGlobalVectorFromField(dm, GetSolutionVectorName(), &solutionVector) >> checkError;
-    // If there is more than one field, unpack the data
-    if (nf > 1) {
-        // Get the local number of particle
-        PetscInt np;
-        DMSwarmGetLocalSize(dm, &np) >> checkError;
-
-        // Get a vector of pointers to the solution fields
-        std::vector<PetscReal *> fieldDatas(nf);
-        std::vector<PetscInt> fieldSizes(nf);
-
-        // get raw access to each array
-        for (auto f = 0; f < nf; f++) {
-            DMSwarmGetField(dm, particleSolutionDescriptors[f].fieldName.c_str(), &fieldSizes[f], NULL, (void **)&fieldDatas[f]) >> checkError;
-        }
+    // Get the local number of particle
+    PetscInt np;
+    DMSwarmGetLocalSize(dm, &np) >> checkError;
 
-        // and raw access to the combined array
-        PetscInt solutionComponents;
-        PetscReal *solutionFieldData;
-        DMSwarmGetField(dm, PackedSolution, &solutionComponents, NULL, (void **)&solutionFieldData) >> checkError;
+    // Get a vector of pointers to the solution fields
+    std::vector<PetscReal *> fieldDatas(nf);
+    std::vector<PetscInt> fieldSizes(nf);
+    PetscInt solutionComponents = 0;
+    for (auto f = 0; f < nf; f++) {
+        DMSwarmGetField(dm, particleSolutionDescriptors[f].fieldName.c_str(), &fieldSizes[f], NULL, (void **)&fieldDatas[f]) >> checkError;
+        solutionComponents += fieldSizes[f];
+    }
 
+    // copy the active particles back to each field
+    const PetscScalar *solutionData;
+    VecGetArrayRead(solution, &solutionData) >> checkError;
+    if (nf == 1) {
+        PetscArraycpy(fieldDatas[0], solutionData, np * solutionComponents) >> checkError;
+    } else {
         for (PetscInt p = 0; p < np; ++p) {
             PetscInt offset = 0;
             // March over each field
             for (PetscInt f = 0; f < nf; ++f) {
                 for (PetscInt c = 0; c < fieldSizes[f]; c++) {
-                    fieldDatas[f][p * fieldSizes[f] + c] = solutionFieldData[p * solutionComponents + offset++];
+                    fieldDatas[f][p * fieldSizes[f] + c] = solutionData[p * solutionComponents + offset++];
                 }
             }
         }
+    }
+    VecRestoreArrayRead(solution, &solutionData) >> checkError;
+
+    // return raw access
+    for (auto f = 0; f < nf; f++) {
+        DMSwarmRestoreField(dm, particleSolutionDescriptors[f].fieldName.c_str(), NULL, NULL, (void **)&fieldDatas[f]) >> checkError;
+    }
+}
+
+void ablate::particles::Particles::InjectParticles() {
+    if (!injectionValid) {
+        DM cellDM;
+        DMSwarmGetCellDM(dm, &cellDM) >> checkError;
+        injectionIdRange = injector->ComputeInjection(cellDM, injectionCoordinates, injectionCells, injectionWeights, injectionIds);
+        injectionValid = true;
+    }
+
+    // start the injected ids after the largest existing id
+    if (nextInjectionId < 0) {
+        PetscInt np;
+        DMSwarmGetLocalSize(dm, &np) >> checkError;
+        PetscInt64 *pid;
+        DMSwarmGetField(dm, DMSwarmField_pid, NULL, NULL, (void **)&pid) >> checkError;
+        PetscInt64 localMaxId = -1;
+        for (PetscInt p = 0; p < np; ++p) {
+            localMaxId = PetscMax(localMaxId, pid[p]);
+        }
+        DMSwarmRestoreField(dm, DMSwarmField_pid, NULL, NULL, (void **)&pid) >> checkError;
+        MPIU_Allreduce(&localMaxId, &nextInjectionId, 1, MPIU_INT64, MPI_MAX, PetscObjectComm((PetscObject)dm));
+        nextInjectionId++;
+    }
+    const PetscInt64 idOffset = nextInjectionId;
+    nextInjectionId += injectionIdRange;
+
+    // the solution buffer is resized collectively, so it must be updated on every rank even if no particles were added locally
+    dmChanged = true;
+    solutionBufferGrowKnown = false;
+    const PetscInt numberInjected = injectionCells.size();
+    if (numberInjected == 0) {
+        return;
+    }
 
-        // return raw access
-        for (auto f = 0; f < nf; f++) {
-            DMSwarmRestoreField(dm, particleSolutionDescriptors[f].fieldName.c_str(), NULL, NULL, (void **)&fieldDatas[f]) >> checkError;
+    // only grow the swarm storage when it is full, leaving room for the following injections
+    PetscInt np;
+    DMSwarmGetLocalSize(dm, &np) >> checkError;
+    swarmCapacity = PetscMax(swarmCapacity, np);
+    if (np + numberInjected > swarmCapacity) {
+        const PetscInt headroom = PetscMax(4 * numberInjected, (np + numberInjected) / 4);
+        DMSwarmSetLocalSizes(dm, np, headroom) >> checkError;
+        swarmCapacity = np + headroom;
+    }
+    DMSwarmAddNPoints(dm, numberInjected) >> checkError;
+
+    // the storage may be reused from removed particles, so zero the real fields of the new particles
+    for (const auto &field : particleFieldDescriptors) {
+        if (field.type == PETSC_REAL) {
+            PetscReal *fieldData;
+            DMSwarmGetField(dm, field.fieldName.c_str(), NULL, NULL, (void **)&fieldData) >> checkError;
+            std::fill(fieldData + np * field.components, fieldData + (np + numberInjected) * field.components, 0.0);
+            DMSwarmRestoreField(dm, field.fieldName.c_str(), NULL, NULL, (void **)&fieldData) >> checkError;
         }
-        DMSwarmRestoreField(dm, PackedSolution, NULL, NULL, (void **)&solutionFieldData) >> checkError;
     }
+
+    // place each new particle in its cell
+    PetscReal *coordinateData, *weightData;
+    PetscInt *cellid;
+    PetscInt64 *pid;
+    DMSwarmGetField(dm, DMSwarmPICField_coor, NULL, NULL, (void **)&coordinateData) >> checkError;
+    DMSwarmGetField(dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellid) >> checkError;
+    DMSwarmGetField(dm, ParticleWeight, NULL, NULL, (void **)&weightData) >> checkError;
+    DMSwarmGetField(dm, DMSwarmField_pid, NULL, NULL, (void **)&pid) >> checkError;
+    std::copy(injectionCoordinates.begin(), injectionCoordinates.end(), coordinateData + np * ndims);
+    std::copy(injectionCells.begin(), injectionCells.end(), cellid + np);
+    std::copy(injectionWeights.begin(), injectionWeights.end(), weightData + np);
+    for (PetscInt p = 0; p < numberInjected; ++p) {
+        pid[np + p] = idOffset + injectionIds[p];
+    }
+    DMSwarmRestoreField(dm, DMSwarmPICField_coor, NULL, NULL, (void **)&coordinateData) >> checkError;
+    DMSwarmRestoreField(dm, DMSwarmPICField_cellid, NULL, NULL, (void **)&cellid) >> checkError;
+    DMSwarmRestoreField(dm, ParticleWeight, NULL, NULL, (void **)&weightData) >> checkError;
+    DMSwarmRestoreField(dm, DMSwarmField_pid, NULL, NULL, (void **)&pid) >> checkError;
+
+    if (exactSolution) {
+        PetscReal *initialLocation;
+        DMSwarmGetField(dm, ParticleInitialLocation, NULL, NULL, (void **)&initialLocation) >> checkError;
+        std::copy(injectionCoordinates.begin(), injectionCoordinates.end(), initialLocation + np * ndims);
+        DMSwarmRestoreField(dm, ParticleInitialLocation, NULL, NULL, (void **)&initialLocation) >> checkError;
+    }
+
+    // project the initialization field onto only the new particles
+    for (auto &field : fieldInitialization) {
+        this->ProjectFunction(field->GetName(), field->GetSolutionField(), np);
+    }
+
+    // the local particles no longer match the interpolation or cell counts
+    ResetFlowVelocityInterpolation();
+    cellParticleCountValid = false;
 }
 
+void ablate::particles::Particles::IntegrateParticles(Vec solution) { TSSolve(particleTs, solution) >> checkError; }
+
 void ablate::particles::Particles::AdvectParticles(TS flowTS) {
     PetscReal time;
+    PetscLogEventBegin(advectLogEvent, dm, 0, 0, 0) >> checkError;
+
+    // end the event before passing on any error so the event stays balanced
+    try {
+        // new particles are added at the start of the step so they are advanced with the flow
+        if (injector && ++stepsSinceInjection >= injectionInterval) {
+            InjectParticles();
+            stepsSinceInjection = 0;
+        }
 
-    // if the dm has changed size (new particles, particles moved between ranks, particles deleted) reset the ts
-    if (dmChanged) {
-        TSReset(particleTs) >> checkError;
-        dmChanged = PETSC_FALSE;
-    }
+        // if the dm has changed size (new particles, particles moved between ranks, particles deleted) update the solution buffer.  The ts is only reset if it must grow.
+        if (dmChanged || !solutionBuffer) {
+            UpdateSolutionBuffer();
+            dmChanged = PETSC_FALSE;
+        }
 
-    // Get the position, velocity and Kinematics vector
-    Vec solutionVector = GetPackedSolutionVector();
+        // Pack the position, velocity and Kinematics into the padded solution buffer
+        PackSolution(solutionBuffer);
 
-    // get the particle time step
-    PetscReal dtInitial;
-    TSGetTimeStep(particleTs, &dtInitial) >> checkError;
+        // get the particle time step
+        PetscReal dtInitial;
+        TSGetTimeStep(particleTs, &dtInitial) >> checkError;
 
-    // Set the max end time based upon the flow end time
-    TSGetTime(flowTS, &time) >> checkError;
-    TSSetMaxTime(particleTs, time) >> checkError;
-    timeFinal = time;
+        // Set the max end time based upon the flow end time
+        TSGetTime(flowTS, &time) >> checkError;
+        TSSetMaxTime(particleTs, time) >> checkError;
+        timeFinal = time;
 
-    // take the needed timesteps to get to the flow time
-    TSSolve(particleTs, solutionVector) >> checkError;
+        // take the needed timesteps to get to the flow time
+        IntegrateParticles(solutionBuffer);
 
-    VecCopy(flowFinal, flowInitial) >> checkError;
-    timeInitial = timeFinal;
+        // keep the start of step velocity for the quadratic interpolation in time
+        if (flowInterpolationOrder > 1 && localVelocityValid) {
+            std::swap(localVelocityPrevious, localVelocityInitial);
+            timePrevious = timeInitial;
+            previousVelocityValid = true;
+        }
+        localVelocityValid = false;
 
-    // get the updated time step, and reset if it has gone down
-    PetscReal dtUpdated;
-    TSGetTimeStep(particleTs, &dtUpdated) >> checkError;
-    if (dtUpdated < dtInitial) {
-        TSSetTimeStep(particleTs, dtInitial) >> checkError;
-    }
+        VecCopy(flowFinal, flowInitial) >> checkError;
+        timeInitial = timeFinal;
 
-    RestorePackedSolutionVector(solutionVector);
+        // get the updated time step, and reset if it has gone down
+        PetscReal dtUpdated;
+        TSGetTimeStep(particleTs, &dtUpdated) >> checkError;
+        if (dtUpdated < dtInitial) {
+            TSSetTimeStep(particleTs, dtInitial) >> checkError;
+        }
 
-    // Migrate any particles that have moved
-    SwarmMigrate();
+        // copy the active particles back
+        UnpackSolution(solutionBuffer);
+
+        // Migrate any particles that have moved
+        SwarmMigrate();
+
+        // periodically restore the cell ordering of the particles
+        if (sortFrequency > 0 && ++stepsSinceSort >= sortFrequency) {
+            SortParticles();
+            stepsSinceSort = 0;
+        }
+    } catch (...) {
+        PetscLogEventEnd(advectLogEvent, dm, 0, 0, 0);
+        throw;
+    }
+    PetscLogEventEnd(advectLogEvent, dm, 0, 0, 0) >> checkError;
 }
 
 static PetscErrorCode DMSequenceViewTimeHDF5(DM dm, PetscViewer viewer) {
@@ -566,3 +1282,88 @@ void ablate::particles::Particles::View(PetscViewer viewer, PetscInt steps, Pets
         DMSequenceViewTimeHDF5(GetDM(), viewer) >> checkError;
     }
 }
+
+std::vector<PetscInt> ablate::particles::Particles::SelectSubsample(DM swarm, PetscInt stride) {
+    stride = PetscMax(1, stride);
+    PetscInt np;
+    DMSwarmGetLocalSize(swarm, &np) >> checkError;
+    PetscInt64 *pid;
+    DMSwarmGetField(swarm, DMSwarmField_pid, NULL, NULL, (void **)&pid) >> checkError;
+    std::vector<PetscInt> selected;
+    selected.reserve(np / stride + 1);
+    for (PetscInt p = 0; p < np; ++p) {
+        if (pid[p] % stride == 0) {
+            selected.push_back(p);
+        }
+    }
+    DMSwarmRestoreField(swarm, DMSwarmField_pid, NULL, NULL, (void **)&pid) >> checkError;
+    return selected;
+}
+
+void ablate::particles::Particles::ViewSubsample(PetscViewer viewer, PetscInt steps, PetscReal time, PetscInt stride, const std::vector<std::string> &fields) const {
+    DMSetOutputSequenceNumber(GetDM(), steps, time) >> checkError;
+    stride = PetscMax(1, stride);
+
+    // determine the fields to write, always including the coordinates
+    std::vector<std::string> viewFields{DMSwarmPICField_coor};
+    for (auto const &field : particleFieldDescriptors) {
+        if (field.type != PETSC_DOUBLE || field.fieldName == DMSwarmPICField_coor) {
+            continue;
+        }
+        if (fields.empty() || std::find(fields.begin(), fields.end(), field.fieldName) != fields.end()) {
+            viewFields.push_back(field.fieldName);
+        }
+    }
+    for (auto const &field : fields) {
+        if (std::find(viewFields.begin(), viewFields.end(), field) == viewFields.end()) {
+            throw std::invalid_argument("Cannot view particle field " + field + " in " + name);
+        }
+    }
+
+    // the same particles are selected every output regardless of where they are stored
+    MPI_Comm comm = PetscObjectComm((PetscObject)dm);
+    const std::vector<PetscInt> selected = SelectSubsample(dm, stride);
+    const PetscInt numberSelected = selected.size();
+
+    PetscBool ishdf5;
+    PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERHDF5, &ishdf5) >> checkError;
+
+    for (auto const &field : viewFields) {
+        PetscInt components;
+        const PetscReal *fieldData;
+        DMSwarmGetField(dm, field.c_str(), &components, NULL, (void **)&fieldData) >> checkError;
+
+        Vec particleVector;
+        VecCreate(comm, &particleVector) >> checkError;
+        VecSetSizes(particleVector, numberSelected * components, PETSC_DETERMINE) >> checkError;
+        VecSetBlockSize(particleVector, components) >> checkError;
+        VecSetType(particleVector, VECSTANDARD) >> checkError;
+        PetscObjectSetName((PetscObject)particleVector, field.c_str()) >> checkError;
+
+        PetscScalar *particleArray;
+        VecGetArrayWrite(particleVector, &particleArray) >> checkError;
+        for (PetscInt s = 0; s < numberSelected; ++s) {
+            for (PetscInt c = 0; c < components; ++c) {
+                particleArray[s * components + c] = fieldData[selected[s] * components + c];
+            }
+        }
+        VecRestoreArrayWrite(particleVector, &particleArray) >> checkError;
+        DMSwarmRestoreField(dm, field.c_str(), NULL, NULL, (void **)&fieldData) >> checkError;
+
+        // match the layout written by the swarm vectors
+        if (ishdf5) {
+            PetscViewerHDF5PushGroup(viewer, "/particle_fields") >> checkError;
+            PetscViewerHDF5SetTimestep(viewer, steps) >> checkError;
+            VecView(particleVector, viewer) >> checkError;
+            PetscViewerHDF5WriteObjectAttribute(viewer, (PetscObject)particleVector, "Nc", PETSC_INT, (void *)&components) >> checkError;
+            PetscViewerHDF5PopGroup(viewer) >> checkError;
+        } else {
+            VecView(particleVector, viewer) >> checkError;
+        }
+        VecDestroy(&particleVector) >> checkError;
+    }
+
+    if (ishdf5) {
+        DMSequenceViewTimeHDF5(GetDM(), viewer) >> checkError;
+    }
+}
@@ -53,29 +53,178 @@ class Particles : public monitors::Viewable {
     // Petsc options specific to these particles. These may be null by default
     PetscOptions petscOptions;
 
+    // log events for the particle advection, interpolation of the flow to the particles, and migration
+    PetscLogEvent advectLogEvent;
+    PetscLogEvent interpolateLogEvent;
+    PetscLogEvent migrateLogEvent;
+
     // store a boolean to state if a dmChanged (number of particles local/global changed)
     bool dmChanged;
     void SwarmMigrate();
 
+    /**
+     * Updates the DMSwarmPICField_cellid of each local particle
+     * @param cellDM
+     * @return true if any local particle is no longer in the local domain
+     */
+    bool UpdateCellIds(DM cellDM);
+
+    // the max number of cells walked by LocateCells before falling back to a search of the local domain
+    inline static const PetscInt maxCellWalk = 32;
+
+    // the flow velocity sub dm and particle interpolation are kept between rhs evaluations.  The sub dm is rebuilt when the flow dm changes and the
+    // interpolation when the particles migrate
+    DM velocityDM = nullptr;
+    IS velocityIS = nullptr;
+    DMInterpolationInfo velocityInterpolation = nullptr;
+
+    // the order of the interpolation in time between the flow snapshots (0: end of step flow, 1: linear between flowInitial and flowFinal, 2: quadratic including
+    // the previous step)
+    const PetscInt flowInterpolationOrder;
+
+    // local copies of the flow velocity at the previous, initial and final times along with the combined velocity at the stage time
+    Vec localVelocityFinal = nullptr;
+    Vec localVelocityInitial = nullptr;
+    Vec localVelocityPrevious = nullptr;
+    Vec localVelocityStage = nullptr;
+    PetscReal timePrevious = 0.0;
+    bool localVelocityValid = false;
+    bool previousVelocityValid = false;
+
+    /**
+     * Updates the local flow velocity snapshots from flowInitial and flowFinal
+     */
+    PetscErrorCode UpdateLocalFlowVelocity();
+
+    /**
+     * Destroys the velocity sub dm and everything built from it
+     */
+    void DestroyFlowVelocityDM();
+
+    /**
+     * Updates the cell containing each point.  Each search starts from the supplied cell and walks across the face neighbors towards the point, so a particle that
+     * moved a few cells is found in O(1).  Points that walk out of the local domain (or have no valid starting cell) fall back to a DMLocatePoints search on this rank.
+     * @param cellDM the flow (cell) dm
+     * @param np the number of points
+     * @param coordinates the point coordinates (np*dim)
+     * @param cells on input the starting cell for each point, on output the containing cell or DMLOCATEPOINT_POINT_NOT_FOUND
+     */
+    static void LocateCells(DM cellDM, PetscInt np, const PetscReal* coordinates, PetscInt* cells);
+
+    /**
+     * Interpolates the flow velocity at the time to each local particle.  The cells located for the previous call are used as the starting point for LocateCells, so the
+     * full point location is only repeated when the number of local particles changes or a particle leaves the local domain
+     * @param time the stage time
+     * @param np the number of local particles
+     * @param coordinates the particle coordinates (np*dim)
+     * @param velocity the vector to hold the interpolated velocity (np*dim)
+     */
+    PetscErrorCode InterpolateFlowVelocity(PetscReal time, PetscInt np, const PetscReal* coordinates, Vec velocity);
+
+    /**
+     * Frees the particle interpolation so that it is rebuilt on the next call to InterpolateFlowVelocity
+     */
+    void ResetFlowVelocityInterpolation();
+
+    // sort the local particles by cell every sortFrequency advection steps (0 is off)
+    const PetscInt sortFrequency;
+    PetscInt stepsSinceSort = 0;
+
+    // the Hilbert order of the cells in cellOrderDM, reset when the flow is repartitioned
+    DM cellOrderDM = nullptr;
+    std::vector<PetscInt> cellOrder;
+
+    /**
+     * Reorders every particle field so that the particles are stored by cell, with the cells in Hilbert order.  This keeps the cell accesses during interpolation
+     * close in memory.
+     */
+    void SortParticles();
+
+    // the cost of each particle relative to a flow cell when the flow is repartitioned (0 is off)
+    const PetscReal partitionWeight;
+
+    // the number of local particles in each flow cell, computed when first needed after the particles move
+    PetscInt cellParticleCountStart = 0;
+    std::vector<PetscInt> cellParticleCount;
+    bool cellParticleCountValid = false;
+
+    /**
+     * Function registered with the FVFlow to add the cost of the particles in each cell to the partition weights
+     * @param flow
+     * @param cell
+     * @param ctx
+     * @return
+     */
+    static PetscReal ComputeParticleCellWeight(ablate::flow::Flow& flow, PetscInt cell, void* ctx);
+
     // Store the particle location and field initialization
     std::shared_ptr<particles::initializers::Initializer> initializer = nullptr;
     const std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization;
 
+    // optional particles injected every injectionInterval flow steps directly on the owning rank
+    const std::shared_ptr<particles::initializers::Initializer> injector;
+    const PetscInt injectionInterval;
+    PetscInt stepsSinceInjection = 0;
+
+    // the number of local particles the swarm storage was last sized to hold
+    PetscInt swarmCapacity = 0;
+
+    // the injected particles only depend on the flow dm, so they are located once and reused until the flow is repartitioned
+    bool injectionValid = false;
+    std::vector<PetscReal> injectionCoordinates;
+    std::vector<PetscInt> injectionCells;
+    std::vector<PetscReal> injectionWeights;
+    std::vector<PetscInt> injectionIds;
+    PetscInt injectionIdRange = 0;
+
+    // the particle id offset for the next injection, so that injected particles do not reuse the ids of existing particles (-1 until the first injection)
+    PetscInt64 nextInjectionId = -1;
+
     /**
-     * Gets and packs the solution vector
-     * @return
+     * Adds the particles computed by the injector to the local swarm.  The swarm storage is grown with headroom so that repeated injection (and the slots freed by
+     * particles leaving the domain) reuse the same allocation, and the new particles are placed directly in their cells so no migration is needed.  Each new
+     * particle id is the id from the injector plus an offset that grows with every injection.
      */
-    Vec GetPackedSolutionVector();
+    void InjectParticles();
+
+    // the particle ts is integrated in a padded copy of the packed solution so that a change in the number of local particles only resets the ts
+    // when the capacity is exceeded.  The tolerance vectors exclude the padding from the time step error.
+    Vec solutionBuffer = nullptr;
+    Vec absoluteTolerance = nullptr;
+    Vec relativeTolerance = nullptr;
+    PetscInt particleCapacity = 0;
+
+    // set when the migration reduction also determined if any rank must grow the solution buffer, so UpdateSolutionBuffer does not need its own reduction
+    bool solutionBufferGrowKnown = false;
+    bool solutionBufferGrow = false;
+
     /**
-     * Unpacks and returns the solution vector
+     * Returns true if the local particles do not fit in the solution buffer
      */
-    void RestorePackedSolutionVector(Vec);
+    bool SolutionBufferTooSmall() const;
 
     /**
-     * Gets and packs the solution vector
-     * @return
+     * Resizes the solution buffer if needed and updates the tolerances for the current number of local particles
+     */
+    void UpdateSolutionBuffer();
+
+    /**
+     * Packs each solution field directly into the solution vector and zeros any padding
+     * @param solution
+     */
+    void PackSolution(Vec solution);
+
+    /**
+     * Copies the active particles in the solution vector back to each solution field
+     * @param solution
      */
-    void UnpackSolutionVector(Vec, std::vector<Vec>);
+    void UnpackSolution(Vec solution);
+
+    /**
+     * Advances the packed particle solution from timeInitial to timeFinal.  By default this is a TSSolve with the particle ts
+     * @param solution
+     */
+    virtual void IntegrateParticles(Vec solution);
 
     /**
      * Function to be be called after each flow time step
@@ -83,12 +232,11 @@ class Particles : public monitors::Viewable {
     void AdvectParticles(TS flowTS);
 
     /**
-     * Get the name of the solution vector
+     * Function to be called after the flow dm has been repartitioned
      */
-    inline const char* GetSolutionVectorName() { return particleSolutionDescriptors.size() == 1 ? DMSwarmPICField_coor : PackedSolution; }
+    void FlowRepartitioned(ablate::flow::Flow &flow);
 
    private:
-    inline static const char PackedSolution[] = "PackedSolution";
     inline static const char ParticleInitialLocation[] = "InitialLocation";
 
     void StoreInitialParticleLocations();
@@ -96,7 +244,8 @@ class Particles : public monitors::Viewable {
 
    public:
     explicit Particles(std::string name, int ndims, std::shared_ptr<particles::initializers::Initializer> initializer, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization,
-                       std::shared_ptr<mathFunctions::MathFunction> exactSolution, std::shared_ptr<parameters::Parameters> options);
+                       std::shared_ptr<mathFunctions::MathFunction> exactSolution, std::shared_ptr<parameters::Parameters> options,
+                       std::shared_ptr<parameters::Parameters> parameters = {}, std::shared_ptr<particles::initializers::Initializer> injector = {});
     virtual ~Particles();
 
     const std::string& GetName() const override { return name; }
@@ -107,7 +256,35 @@ class Particles : public monitors::Viewable {
 
     virtual void InitializeFlow(std::shared_ptr<flow::Flow> flow);
 
-    void ProjectFunction(const std::string& field, ablate::mathFunctions::MathFunction& mathFunction);
+    void ProjectFunction(const std::string& field, ablate::mathFunctions::MathFunction& mathFunction, PetscInt start = 0);
+
+    /**
+     * The number of physical particles represented by all parcels across all ranks
+     * @return
+     */
+    PetscReal ComputeTotalWeight() const { return ComputeTotalWeight(dm); }
+
+    /**
+     * Computes the mean of each component of a PETSC_REAL field over all physical particles, i.e. each parcel is weighted by its ParticleWeight
+     * @param field
+     * @return
+     */
+    std::vector<PetscReal> ComputeWeightedMean(const std::string& field) const { return ComputeWeightedMean(dm, field); }
+
+    /**
+     * The number of physical particles represented by all parcels in the swarm across all ranks
+     * @param swarm
+     * @return
+     */
+    static PetscReal ComputeTotalWeight(DM swarm);
+
+    /**
+     * Computes the parcel weighted mean of each component of a PETSC_REAL field in the swarm
+     * @param swarm
+     * @param field
+     * @return
+     */
+    static std::vector<PetscReal> ComputeWeightedMean(DM swarm, const std::string& field);
 
     /**
      * shared function to view all particles;
@@ -118,10 +295,30 @@ class Particles : public monitors::Viewable {
      */
     void View(PetscViewer viewer, PetscInt steps, PetscReal time, Vec u) const override;
 
+    /**
+     * Selects the local particles with an id that is a multiple of stride.  Because the selection depends only upon the particle id, the same particles are
+     * selected at every output and for any number of ranks.
+     * @param swarm
+     * @param stride
+     * @return the local index of each selected particle
+     */
+    static std::vector<PetscInt> SelectSubsample(DM swarm, PetscInt stride);
+
+    /**
+     * View only the particles with an id that is a multiple of stride and the selected fields.  The particle coordinates are always included.
+     * @param viewer
+     * @param steps
+     * @param time
+     * @param stride
+     * @param fields the fields to view, all real fields if empty
+     */
+    void ViewSubsample(PetscViewer viewer, PetscInt steps, PetscReal time, PetscInt stride, const std::vector<std::string>& fields) const;
+
     /** common field names for particles **/
     inline static const char ParticleVelocity[] = "ParticleVelocity";
     inline static const char ParticleDiameter[] = "ParticleDiameter";
     inline static const char ParticleDensity[] = "ParticleDensity";
+    inline static const char ParticleWeight[] = "ParticleWeight";
 
     // Helper function useful for tests
     static PetscErrorCode ComputeParticleExactSolution(TS particleTS, Vec);
@@ -3,8 +3,9 @@
 #include "utilities/petscError.hpp"
 
 ablate::particles::Tracer::Tracer(std::string name, int ndims, std::shared_ptr<particles::initializers::Initializer> initializer, std::shared_ptr<mathFunctions::MathFunction> exactSolution,
-                                  std::shared_ptr<parameters::Parameters> options)
-    : Particles(name, ndims, initializer, {}, exactSolution, options) {
+                                  std::shared_ptr<parameters::Parameters> options, std::shared_ptr<parameters::Parameters> parameters,
+                                  std::shared_ptr<particles::initializers::Initializer> injector)
+    : Particles(name, ndims, initializer, {}, exactSolution, options, parameters, injector) {
     RegisterField(ParticleFieldDescriptor{.fieldName = ParticleVelocity, .components = ndims, .type = PETSC_REAL});
 }
 
@@ -31,14 +32,10 @@ void ablate::particles::Tracer::InitializeFlow(std::shared_ptr<flow::Flow> flow)
 */
 PetscErrorCode ablate::particles::Tracer::freeStreaming(TS ts, PetscReal t, Vec X, Vec F, void *ctx) {
     ablate::particles::Tracer *particles = (ablate::particles::Tracer *)ctx;
-    Vec u = particles->flowFinal;
-    DM sdm, dm, vdm;
-    Vec vel, locvel, pvel;
-    IS vis;
-    DMInterpolationInfo ictx;
+    DM sdm, dm;
+    Vec pvel;
     const PetscScalar *coords, *v;
     PetscScalar *f;
-    PetscInt vf[1] = {particles->flowVelocityFieldIndex};
     PetscInt dim, Np;
     PetscErrorCode ierr;
 
@@ -54,55 +51,17 @@ PetscErrorCode ablate::particles::Tracer::freeStreaming(TS ts, PetscReal t, Vec
     ierr = DMGetDimension(dm, &dim);
     CHKERRQ(ierr);
 
-    /* Get local velocity */
-    ierr = DMCreateSubDM(dm, 1, vf, &vis, &vdm);
-    CHKERRQ(ierr);
-    ierr = VecGetSubVector(u, vis, &vel);
-    CHKERRQ(ierr);
-    ierr = DMGetLocalVector(vdm, &locvel);
-    CHKERRQ(ierr);
-    ierr = DMPlexInsertBoundaryValues(vdm, PETSC_TRUE, locvel, particles->timeInitial, NULL, NULL, NULL);
-    CHKERRQ(ierr);
-    ierr = DMGlobalToLocalBegin(vdm, vel, INSERT_VALUES, locvel);
-    CHKERRQ(ierr);
-    ierr = DMGlobalToLocalEnd(vdm, vel, INSERT_VALUES, locvel);
-    CHKERRQ(ierr);
-    ierr = VecRestoreSubVector(u, vis, &vel);
-    CHKERRQ(ierr);
-    ierr = ISDestroy(&vis);
-    CHKERRQ(ierr);
-
     /* Interpolate velocity */
-    ierr = DMInterpolationCreate(PETSC_COMM_SELF, &ictx);
-    CHKERRQ(ierr);
-    ierr = DMInterpolationSetDim(ictx, dim);
-    CHKERRQ(ierr);
-    ierr = DMInterpolationSetDof(ictx, dim);
-    CHKERRQ(ierr);
     ierr = VecGetArrayRead(X, &coords);
     CHKERRQ(ierr);
-    ierr = DMInterpolationAddPoints(ictx, Np, (PetscReal *)coords);
+    ierr = particles->InterpolateFlowVelocity(t, Np, (const PetscReal *)coords, pvel);
     CHKERRQ(ierr);
     ierr = VecRestoreArrayRead(X, &coords);
     CHKERRQ(ierr);
 
-    /* Particles that lie outside the domain should be dropped,
-     whereas particles that move to another partition should trigger a migration */
-    ierr = DMInterpolationSetUp(ictx, vdm, PETSC_FALSE, PETSC_TRUE);
-    CHKERRQ(ierr);
-    ierr = VecSet(pvel, 0.);
-    CHKERRQ(ierr);
-
-    ierr = DMInterpolationEvaluate(ictx, vdm, locvel, pvel);
+    // right hand side storing, the padding past the local particles does not change
+    ierr = VecZeroEntries(F);
     CHKERRQ(ierr);
-    ierr = DMInterpolationDestroy(&ictx);
-    CHKERRQ(ierr);
-    ierr = DMRestoreLocalVector(vdm, &locvel);
-    CHKERRQ(ierr);
-    ierr = DMDestroy(&vdm);
-    CHKERRQ(ierr);
-
-    // right hand side storing
     ierr = VecGetArray(F, &f);
     CHKERRQ(ierr);
     ierr = VecGetArrayRead(pvel, &v);
@@ -122,4 +81,9 @@ PetscErrorCode ablate::particles::Tracer::freeStreaming(TS ts, PetscReal t, Vec
 #include "parser/registrar.hpp"
 REGISTER(ablate::particles::Particles, ablate::particles::Tracer, "massless particles that advect with the flow", ARG(std::string, "name", "the name of the particle group"),
          ARG(int, "ndims", "the number of dimensions for the particle"), ARG(particles::initializers::Initializer, "initializer", "the initial particle setup methods"),
-         OPT(mathFunctions::MathFunction, "exactSolution", "the particle location exact solution"), ARG(parameters::Parameters, "options", "options to be passed to petsc"));
\ No newline at end of file
+         OPT(mathFunctions::MathFunction, "exactSolution", "the particle location exact solution"), ARG(parameters::Parameters, "options", "options to be passed to petsc"),
+         OPT(parameters::Parameters, "parameters",
+             "optional particle parameters: sortFrequency (sort the particles by cell every n flow steps, default is off), flowInterpolationOrder (interpolate the flow velocity "
+             "in time, 1 linear or 2 quadratic, default is 0 the end of step flow), partitionWeight (the cost of each particle relative to a flow cell when repartitioning a "
+             "FVFlow, default is 0), injectionInterval (inject particles every n flow steps, default is every step)"),
+         OPT(particles::initializers::Initializer, "injector", "optional initializer used to inject new particles during the simulation (only the BoxInitializer supports injection)"));
\ No newline at end of file
@@ -6,7 +6,8 @@ namespace ablate::particles {
 class Tracer : public Particles {
    public:
     Tracer(std::string name, int ndims, std::shared_ptr<particles::initializers::Initializer> initializer, std::shared_ptr<mathFunctions::MathFunction> exactSolution = {},
-           std::shared_ptr<parameters::Parameters> options = {});
+           std::shared_ptr<parameters::Parameters> options = {}, std::shared_ptr<parameters::Parameters> parameters = {},
+           std::shared_ptr<particles::initializers::Initializer> injector = {});
     ~Tracer() override;
 
     void InitializeFlow(std::shared_ptr<flow::Flow> flow) override;
@@ -1,11 +1,15 @@
 #include "timeStepper.hpp"
 #include <petscdm.h>
+#include <lowStorageRK.h>
 #include <mathFunctions/mathFunction.hpp>
 #include "parser/registrar.hpp"
 #include "utilities/petscError.hpp"
 #include "utilities/petscOptions.hpp"
 
 ablate::solve::TimeStepper::TimeStepper(std::string nameIn, std::map<std::string, std::string> arguments) : name(nameIn), tsLogStage() {
+    // make the ablate specific ts types available to ts_type
+    TSRegisterLowStorageRK() >> checkError;
+
     // create an instance of the ts
     TSCreate(PETSC_COMM_WORLD, &ts) >> checkError;
 
@@ -0,0 +1,90 @@
+#include "hilbertOrder.hpp"
+#include <algorithm>
+#include <numeric>
+#include "petscError.hpp"
+
+uint64_t ablate::utilities::HilbertOrder::ComputeKey(PetscInt dim, const PetscReal point[], const PetscReal lower[], const PetscReal upper[]) {
+    // quantize each coordinate within the box
+    const PetscInt bits = dim > 0 ? PetscMin(64 / dim, 21) : 1;
+    const uint64_t maxCoordinate = ((uint64_t)1 << bits) - 1;
+    uint64_t x[3] = {0, 0, 0};
+    for (PetscInt d = 0; d < dim; ++d) {
+        PetscReal range = upper[d] - lower[d];
+        PetscReal fraction = range > 0.0 ? (point[d] - lower[d]) / range : 0.0;
+        fraction = PetscMax(0.0, PetscMin(1.0, fraction));
+        x[d] = PetscMin((uint64_t)(fraction * (PetscReal)((uint64_t)1 << bits)), maxCoordinate);
+    }
+
+    // convert the coordinates to the transposed Hilbert index (Skilling, "Programming the Hilbert curve", 2004)
+    const uint64_t m = (uint64_t)1 << (bits - 1);
+    for (uint64_t q = m; q > 1; q >>= 1) {
+        const uint64_t p = q - 1;
+        for (PetscInt d = 0; d < dim; ++d) {
+            if (x[d] & q) {
+                x[0] ^= p;
+            } else {
+                uint64_t t = (x[0] ^ x[d]) & p;
+                x[0] ^= t;
+                x[d] ^= t;
+            }
+        }
+    }
+
+    // gray encode
+    for (PetscInt d = 1; d < dim; ++d) {
+        x[d] ^= x[d - 1];
+    }
+    uint64_t t = 0;
+    for (uint64_t q = m; q > 1; q >>= 1) {
+        if (x[dim - 1] & q) {
+            t ^= q - 1;
+        }
+    }
+    for (PetscInt d = 0; d < dim; ++d) {
+        x[d] ^= t;
+    }
+
+    // interleave the transposed bits into the key
+    uint64_t key = 0;
+    for (PetscInt b = bits - 1; b >= 0; --b) {
+        for (PetscInt d = 0; d < dim; ++d) {
+            key = (key << 1) | ((x[d] >> b) & 1);
+        }
+    }
+    return key;
+}
+
+std::vector<PetscInt> ablate::utilities::HilbertOrder::ComputeCellOrder(DM dm, PetscInt cStart, PetscInt cEnd) {
+    PetscInt dim;
+    DMGetCoordinateDim(dm, &dim) >> checkError;
+    const PetscInt numberCells = cEnd - cStart;
+
+    // compute the centroid and bounding box of the cells
+    std::vector<PetscReal> centroids(numberCells * dim);
+    PetscReal lower[3] = {PETSC_MAX_REAL, PETSC_MAX_REAL, PETSC_MAX_REAL};
+    PetscReal upper[3] = {PETSC_MIN_REAL, PETSC_MIN_REAL, PETSC_MIN_REAL};
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscReal* centroid = &centroids[(c - cStart) * dim];
+        DMPlexComputeCellGeometryFVM(dm, c, NULL, centroid, NULL) >> checkError;
+        for (PetscInt d = 0; d < dim; ++d) {
+            lower[d] = PetscMin(lower[d], centroid[d]);
+            upper[d] = PetscMax(upper[d], centroid[d]);
+        }
+    }
+
+    // sort the cells by key
+    std::vector<uint64_t> keys(numberCells);
+    for (PetscInt c = 0; c < numberCells; ++c) {
+        keys[c] = ComputeKey(dim, &centroids[c * dim], lower, upper);
+    }
+    std::vector<PetscInt> sortedCells(numberCells);
+    std::iota(sortedCells.begin(), sortedCells.end(), 0);
+    std::stable_sort(sortedCells.begin(), sortedCells.end(), [&keys](PetscInt a, PetscInt b) { return keys[a] < keys[b]; });
+
+    // invert to get the position of each cell
+    std::vector<PetscInt> order(numberCells);
+    for (PetscInt i = 0; i < numberCells; ++i) {
+        order[sortedCells[i]] = i;
+    }
+    return order;
+}
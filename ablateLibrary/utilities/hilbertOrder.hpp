@@ -0,0 +1,37 @@
+#ifndef ABLATELIBRARY_HILBERTORDER_HPP
+#define ABLATELIBRARY_HILBERTORDER_HPP
+
+#include <petsc.h>
+#include <cstdint>
+#include <vector>
+
+namespace ablate::utilities {
+/**
+ * Orders points/cells along a Hilbert space filling curve so that points close in space are close in memory
+ */
+class HilbertOrder {
+   private:
+    HilbertOrder() = delete;
+
+   public:
+    /**
+     * Computes the Hilbert index of the point within the bounding box.  The number of bits per dimension is chosen so the key fits in 64 bits.
+     * @param dim
+     * @param point
+     * @param lower the lower corner of the bounding box
+     * @param upper the upper corner of the bounding box
+     * @return
+     */
+    static uint64_t ComputeKey(PetscInt dim, const PetscReal point[], const PetscReal lower[], const PetscReal upper[]);
+
+    /**
+     * Computes the order of the cells [cStart, cEnd) along the Hilbert curve through the cell centroids
+     * @param dm
+     * @param cStart
+     * @param cEnd
+     * @return the position of each cell (c - cStart) in the Hilbert order
+     */
+    static std::vector<PetscInt> ComputeCellOrder(DM dm, PetscInt cStart, PetscInt cEnd);
+};
+}  // namespace ablate::utilities
+#endif  // ABLATELIBRARY_HILBERTORDER_HPP
@@ -0,0 +1,72 @@
+#include "reductionAggregator.hpp"
+#include <stdexcept>
+#include "mpiError.hpp"
+
+ablate::utilities::ReductionAggregator::ReductionAggregator(MPI_Comm comm) : comm(comm) {
+    MPI_Type_contiguous(2, MPIU_REAL, &entryType) >> checkMpiError;
+    MPI_Type_commit(&entryType) >> checkMpiError;
+    MPI_Op_create(ReduceEntries, 1, &entryOp) >> checkMpiError;
+}
+
+ablate::utilities::ReductionAggregator::~ReductionAggregator() {
+    if (request != MPI_REQUEST_NULL) {
+        MPI_Wait(&request, MPI_STATUS_IGNORE);
+    }
+    MPI_Op_free(&entryOp);
+    MPI_Type_free(&entryType);
+}
+
+void ablate::utilities::ReductionAggregator::ReduceEntries(void* in, void* inOut, int* length, MPI_Datatype*) {
+    auto inEntries = (Entry*)in;
+    auto inOutEntries = (Entry*)inOut;
+    for (int i = 0; i < *length; i++) {
+        switch ((Operation)(int)inEntries[i].operation) {
+            case Operation::MIN:
+                inOutEntries[i].value = PetscMin(inEntries[i].value, inOutEntries[i].value);
+                break;
+            case Operation::MAX:
+                inOutEntries[i].value = PetscMax(inEntries[i].value, inOutEntries[i].value);
+                break;
+            case Operation::SUM:
+                inOutEntries[i].value += inEntries[i].value;
+                break;
+        }
+    }
+}
+
+std::size_t ablate::utilities::ReductionAggregator::Add(PetscReal value, Operation operation) {
+    if (started) {
+        throw std::runtime_error("Values cannot be added to the ReductionAggregator after the reduction has started.");
+    }
+    localEntries.push_back({.value = value, .operation = (PetscReal)(int)operation});
+    return localEntries.size() - 1;
+}
+
+void ablate::utilities::ReductionAggregator::Start() {
+    if (started) {
+        return;
+    }
+    globalEntries.resize(localEntries.size());
+    if (!localEntries.empty()) {
+        MPI_Iallreduce(&localEntries[0], &globalEntries[0], (int)localEntries.size(), entryType, entryOp, comm, &request) >> checkMpiError;
+    }
+    started = true;
+}
+
+PetscReal ablate::utilities::ReductionAggregator::Get(std::size_t index) {
+    // start the reduction if it has not been started
+    Start();
+    if (request != MPI_REQUEST_NULL) {
+        MPI_Wait(&request, MPI_STATUS_IGNORE) >> checkMpiError;
+    }
+    return globalEntries.at(index).value;
+}
+
+void ablate::utilities::ReductionAggregator::Reset() {
+    if (request != MPI_REQUEST_NULL) {
+        MPI_Wait(&request, MPI_STATUS_IGNORE) >> checkMpiError;
+    }
+    localEntries.clear();
+    globalEntries.clear();
+    started = false;
+}
@@ -0,0 +1,68 @@
+#ifndef ABLATELIBRARY_REDUCTIONAGGREGATOR_HPP
+#define ABLATELIBRARY_REDUCTIONAGGREGATOR_HPP
+#include <petsc.h>
+#include <vector>
+
+namespace ablate::utilities {
+
+/**
+ * Collects independent global reductions (min, max, sum) so that they are carried by a single non-blocking MPI_Iallreduce.  Contributions are
+ * added, the reduction is started, and the reduction is only completed the first time a result is requested.
+ */
+class ReductionAggregator {
+   public:
+    enum class Operation { MIN, MAX, SUM };
+
+   private:
+    // each value carries its operation so that mixed operations can be reduced with a single mpi op
+    struct Entry {
+        PetscReal value;
+        PetscReal operation;
+    };
+
+    const MPI_Comm comm;
+    MPI_Datatype entryType;
+    MPI_Op entryOp;
+
+    std::vector<Entry> localEntries;
+    std::vector<Entry> globalEntries;
+    MPI_Request request = MPI_REQUEST_NULL;
+    bool started = false;
+
+    static void ReduceEntries(void* in, void* inOut, int* length, MPI_Datatype* type);
+
+   public:
+    explicit ReductionAggregator(MPI_Comm comm);
+    ~ReductionAggregator();
+
+    ReductionAggregator(const ReductionAggregator&) = delete;
+    ReductionAggregator& operator=(const ReductionAggregator&) = delete;
+
+    /**
+     * Adds a local contribution to the next reduction
+     * @param value
+     * @param operation
+     * @return the index used to get the result
+     */
+    std::size_t Add(PetscReal value, Operation operation);
+
+    /**
+     * Starts the fused non-blocking reduction of all added values
+     */
+    void Start();
+
+    /**
+     * Returns the reduced value, waiting for the reduction to complete if needed
+     * @param index
+     * @return
+     */
+    PetscReal Get(std::size_t index);
+
+    /**
+     * Completes any outstanding reduction and clears all values so the aggregator can be reused
+     */
+    void Reset();
+};
+
+}  // namespace ablate::utilities
+#endif  // ABLATELIBRARY_REDUCTIONAGGREGATOR_HPP
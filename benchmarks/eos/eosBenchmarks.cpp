@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
+#include "eos/perfectGas.hpp"
+#include "eos/tChem.hpp"
+#include "parameters/mapParameters.hpp"
+#include "utilities/petscError.hpp"
+
+using namespace ablate;
+
+namespace {
+/**
+ * Creates the densityYi for each species from the mass fractions specified
+ */
+std::vector<PetscReal> GetDensityYi(const std::vector<std::string>& species, const std::map<std::string, PetscReal>& yiIn, PetscReal density) {
+    std::vector<PetscReal> densityYi(species.size(), 0.0);
+    for (const auto& value : yiIn) {
+        auto it = std::find(species.begin(), species.end(), value.first);
+        if (it != species.end()) {
+            densityYi[std::distance(species.begin(), it)] = value.second * density;
+        }
+    }
+    return densityYi;
+}
+
+/**
+ * Runs the decode state function on a fixed state once per iteration
+ */
+void RunDecodeState(benchmark::State& state, eos::EOS& eos, PetscReal density, PetscReal totalEnergy, const std::vector<PetscReal>& densityYi) {
+    const PetscInt dim = 2;
+    const PetscReal velocity[2] = {10.0, 5.0};
+    auto decodeFunction = eos.GetDecodeStateFunction();
+    auto decodeContext = eos.GetDecodeStateContext();
+
+    for (auto _ : state) {
+        PetscReal internalEnergy, a, p;
+        decodeFunction(dim, density, totalEnergy, velocity, densityYi.empty() ? nullptr : &densityYi[0], &internalEnergy, &a, &p, decodeContext) >> checkError;
+        benchmark::DoNotOptimize(internalEnergy);
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(p);
+    }
+    state.counters["cells/s"] = benchmark::Counter(1.0, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * Runs the compute temperature function on a fixed state once per iteration
+ */
+void RunComputeTemperature(benchmark::State& state, eos::EOS& eos, PetscReal density, PetscReal totalEnergy, const std::vector<PetscReal>& densityYi) {
+    const PetscInt dim = 2;
+    const PetscReal massFlux[2] = {10.0 * density, 5.0 * density};
+    auto temperatureFunction = eos.GetComputeTemperatureFunction();
+    auto temperatureContext = eos.GetComputeTemperatureContext();
+
+    for (auto _ : state) {
+        PetscReal temperature;
+        temperatureFunction(dim, density, totalEnergy, massFlux, densityYi.empty() ? nullptr : &densityYi[0], &temperature, temperatureContext) >> checkError;
+        benchmark::DoNotOptimize(temperature);
+    }
+    state.counters["cells/s"] = benchmark::Counter(1.0, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+std::shared_ptr<eos::PerfectGas> CreatePerfectGas() {
+    return std::make_shared<eos::PerfectGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}, {"Rgas", "287.0"}}));
+}
+
+std::shared_ptr<eos::TChem> CreateTChem() { return std::make_shared<eos::TChem>("inputs/eos/grimech30.dat", "inputs/eos/thermo30.dat"); }
+
+// a methane/air mixture at an elevated temperature
+const std::map<std::string, PetscReal> methaneAir = {{"CH4", 0.2}, {"O2", 0.2}, {"N2", 0.6}};
+}  // namespace
+
+static void BM_PerfectGasDecodeState(benchmark::State& state) {
+    auto eos = CreatePerfectGas();
+    RunDecodeState(state, *eos, 1.1, 250050.0, {});
+}
+BENCHMARK(BM_PerfectGasDecodeState);
+
+static void BM_PerfectGasComputeTemperature(benchmark::State& state) {
+    auto eos = CreatePerfectGas();
+    RunComputeTemperature(state, *eos, 1.1, 250050.0, {});
+}
+BENCHMARK(BM_PerfectGasComputeTemperature);
+
+static void BM_TChemDecodeState(benchmark::State& state) {
+    auto eos = CreateTChem();
+    RunDecodeState(state, *eos, 1.0, 1498029.067485712, GetDensityYi(eos->GetSpecies(), methaneAir, 1.0));
+}
+BENCHMARK(BM_TChemDecodeState);
+
+static void BM_TChemComputeTemperature(benchmark::State& state) {
+    auto eos = CreateTChem();
+    RunComputeTemperature(state, *eos, 1.0, 1498029.067485712, GetDensityYi(eos->GetSpecies(), methaneAir, 1.0));
+}
+BENCHMARK(BM_TChemComputeTemperature);
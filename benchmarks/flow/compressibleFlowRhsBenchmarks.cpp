@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+#include <memory>
+#include "eos/perfectGas.hpp"
+#include "flow/compressibleFlow.hpp"
+#include "flow/fluxCalculator/ausm.hpp"
+#include "flow/fluxCalculator/ausmpUp.hpp"
+#include "mathFunctions/functionFactory.hpp"
+#include "mesh/boxMesh.hpp"
+#include "parameters/mapParameters.hpp"
+#include "utilities/petscError.hpp"
+
+using namespace ablate;
+
+/**
+ * Times the full finite volume rhs evaluation (ABLATE_DMPlexComputeRHSFunctionFVM through the FVFlow) for a periodic perfect gas box mesh.
+ * The arguments are the number of faces in each direction and the flux calculator (0 = AUSM, 1 = AUSM+up)
+ */
+static void BM_CompressibleFlowRHS(benchmark::State& state) {
+    const int faces = (int)state.range(0);
+    std::shared_ptr<flow::fluxCalculator::FluxCalculator> fluxCalculator;
+    if (state.range(1) == 0) {
+        fluxCalculator = std::make_shared<flow::fluxCalculator::Ausm>();
+    } else {
+        fluxCalculator = std::make_shared<flow::fluxCalculator::AusmpUp>(0.3);
+    }
+
+    auto mesh = std::make_shared<mesh::BoxMesh>(
+        "benchmarkMesh", std::vector<int>{faces, faces}, std::vector<double>{0.0, 0.0}, std::vector<double>{1.0, 1.0}, std::vector<std::string>{"PERIODIC", "PERIODIC"}, false);
+    auto eos = std::make_shared<eos::PerfectGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+    auto parameters = std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"cfl", "0.5"}});
+
+    // a smooth density wave so that the gradients/limiters are exercised
+    auto initialization = std::make_shared<mathFunctions::FieldFunction>(
+        "euler", mathFunctions::Create("1.0 + 0.1*sin(6.283185307179586*x)*cos(6.283185307179586*y), 250050.0 + 25000.0*sin(6.283185307179586*x), 10.0, 5.0"));
+
+    auto flowObject = std::make_shared<flow::CompressibleFlow>("benchmarkFlow",
+                                                               mesh,
+                                                               eos,
+                                                               parameters,
+                                                               nullptr /*transportModel*/,
+                                                               fluxCalculator,
+                                                               nullptr /*options*/,
+                                                               std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{initialization});
+
+    TS ts;
+    TSCreate(PETSC_COMM_WORLD, &ts) >> checkError;
+    TSSetProblemType(ts, TS_NONLINEAR) >> checkError;
+    flowObject->CompleteProblemSetup(ts);
+
+    Vec u = flowObject->GetSolutionVector();
+    Vec f;
+    VecDuplicate(u, &f) >> checkError;
+
+    for (auto _ : state) {
+        TSComputeRHSFunction(ts, 0.0, u, f) >> checkError;
+    }
+
+    state.counters["cells/s"] = benchmark::Counter((double)faces * faces, benchmark::Counter::kIsIterationInvariantRate);
+
+    VecDestroy(&f) >> checkError;
+    TSDestroy(&ts) >> checkError;
+}
+BENCHMARK(BM_CompressibleFlowRHS)->ArgsProduct({{32, 64, 128}, {0, 1}})->ArgNames({"faces", "flux"})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+#include <memory>
+#include <vector>
+#include "flow/fluxCalculator/ausm.hpp"
+#include "flow/fluxCalculator/ausmpUp.hpp"
+
+using namespace ablate;
+
+namespace {
+struct FaceState {
+    PetscReal uL, aL, rhoL, pL;
+    PetscReal uR, aR, rhoR, pR;
+};
+
+/**
+ * Builds a reproducible set of left/right states that span subsonic and supersonic faces in both directions
+ */
+std::vector<FaceState> CreateFaceStates(std::size_t numberFaces) {
+    std::vector<FaceState> states(numberFaces);
+    const PetscReal gamma = 1.4;
+    for (std::size_t i = 0; i < numberFaces; i++) {
+        const PetscReal s = (PetscReal)i / (PetscReal)numberFaces;
+        auto& state = states[i];
+        state.rhoL = 1.0 + 0.5 * s;
+        state.pL = 1.0E5 * (1.0 + s);
+        state.aL = PetscSqrtReal(gamma * state.pL / state.rhoL);
+        state.uL = (2.0 * s - 1.0) * 1.5 * state.aL;
+        state.rhoR = 1.5 - 0.5 * s;
+        state.pR = 1.0E5 * (2.0 - s);
+        state.aR = PetscSqrtReal(gamma * state.pR / state.rhoR);
+        state.uR = (1.0 - 2.0 * s) * 1.5 * state.aR;
+    }
+    return states;
+}
+}  // namespace
+
+/**
+ * Times the pointwise flux calculator used by the EulerAdvection process for each face
+ */
+static void BM_FluxCalculator(benchmark::State& state, std::shared_ptr<flow::fluxCalculator::FluxCalculator> fluxCalculator) {
+    const auto faceStates = CreateFaceStates((std::size_t)state.range(0));
+    auto function = fluxCalculator->GetFluxCalculatorFunction();
+    auto context = fluxCalculator->GetFluxCalculatorContext();
+
+    for (auto _ : state) {
+        for (const auto& face : faceStates) {
+            PetscReal massFlux, p12;
+            auto direction = function(context, face.uL, face.aL, face.rhoL, face.pL, face.uR, face.aR, face.rhoR, face.pR, &massFlux, &p12);
+            benchmark::DoNotOptimize(direction);
+            benchmark::DoNotOptimize(massFlux);
+            benchmark::DoNotOptimize(p12);
+        }
+    }
+
+    state.counters["faces/s"] = benchmark::Counter((double)faceStates.size(), benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK_CAPTURE(BM_FluxCalculator, ausm, std::make_shared<flow::fluxCalculator::Ausm>())->Arg(4096);
+BENCHMARK_CAPTURE(BM_FluxCalculator, ausmpUp, std::make_shared<flow::fluxCalculator::AusmpUp>(0.3))->Arg(4096);
@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+#include <algorithm>
+#include <memory>
+#include "eos/tChem.hpp"
+#include "flow/reactingCompressibleFlow.hpp"
+#include "mathFunctions/functionFactory.hpp"
+#include "mesh/boxMesh.hpp"
+#include "parameters/mapParameters.hpp"
+#include "utilities/petscError.hpp"
+
+using namespace ablate;
+
+/**
+ * Times a single explicit step of a periodic reacting flow box.  The step is dominated by the per cell TChemReactions integration that is done in the pre stage.
+ * The argument is the number of faces in each direction.
+ */
+static void BM_TChemReactionsStep(benchmark::State& state) {
+    const int faces = (int)state.range(0);
+
+    auto mesh = std::make_shared<mesh::BoxMesh>(
+        "benchmarkMesh", std::vector<int>{faces, faces}, std::vector<double>{-0.1, -0.1}, std::vector<double>{0.1, 0.1}, std::vector<std::string>{"PERIODIC", "PERIODIC"}, false);
+    auto eos = std::make_shared<eos::TChem>("inputs/eos/grimech30.dat", "inputs/eos/thermo30.dat");
+    auto parameters = std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"cfl", "0.4"}});
+
+    // a hot methane/air mixture so that the chemistry is active in every cell
+    const auto& species = eos->GetSpecies();
+    std::vector<double> densityYi(species.size(), 0.0);
+    for (const auto& [name, yi] : std::map<std::string, double>{{"CH4", 0.2}, {"O2", 0.2}, {"N2", 0.6}}) {
+        auto it = std::find(species.begin(), species.end(), name);
+        if (it != species.end()) {
+            densityYi[std::distance(species.begin(), it)] = yi;
+        }
+    }
+    auto initialization = std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{
+        std::make_shared<mathFunctions::FieldFunction>("euler", mathFunctions::Create(std::vector<double>{1.0, 1498029.067485712, 0.0, 0.0})),
+        std::make_shared<mathFunctions::FieldFunction>("densityYi", mathFunctions::Create(densityYi))};
+
+    auto flowObject = std::make_shared<flow::ReactingCompressibleFlow>("benchmarkFlow", mesh, eos, parameters, nullptr, nullptr, nullptr, initialization);
+
+    TS ts;
+    TSCreate(PETSC_COMM_WORLD, &ts) >> checkError;
+    TSSetProblemType(ts, TS_NONLINEAR) >> checkError;
+    TSSetType(ts, TSEULER) >> checkError;
+    TSSetExactFinalTime(ts, TS_EXACTFINALTIME_MATCHSTEP) >> checkError;
+    flowObject->CompleteProblemSetup(ts);
+    TSSetMaxSteps(ts, 1) >> checkError;
+    TSSetTimeStep(ts, 1E-6) >> checkError;
+
+    // hold the initial condition so that each iteration starts from the same state
+    Vec u = flowObject->GetSolutionVector();
+    Vec initialCondition;
+    VecDuplicate(u, &initialCondition) >> checkError;
+    VecCopy(u, initialCondition) >> checkError;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        VecCopy(initialCondition, u) >> checkError;
+        TSSetTime(ts, 0.0) >> checkError;
+        TSSetStepNumber(ts, 0) >> checkError;
+        TSSetTimeStep(ts, 1E-6) >> checkError;
+        state.ResumeTiming();
+
+        TSSolve(ts, u) >> checkError;
+    }
+
+    state.counters["cells/s"] = benchmark::Counter((double)faces * faces, benchmark::Counter::kIsIterationInvariantRate);
+
+    VecDestroy(&initialCondition) >> checkError;
+    TSDestroy(&ts) >> checkError;
+}
+BENCHMARK(BM_TChemReactionsStep)->Arg(8)->Arg(16)->ArgName("faces")->Unit(benchmark::kMillisecond);
@@ -0,0 +1,19 @@
+static char help[] = "ABLATE performance benchmarks";
+
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+
+int main(int argc, char** argv) {
+    // let google benchmark remove its arguments before passing the rest to petsc
+    benchmark::Initialize(&argc, argv);
+
+    PetscErrorCode ierr = PetscInitialize(&argc, &argv, NULL, help);
+    if (ierr) {
+        return ierr;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return PetscFinalize();
+}
@@ -0,0 +1,151 @@
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+#include <memory>
+#include <numeric>
+#include <vector>
+#include "mesh/boxMesh.hpp"
+#include "utilities/hilbertOrder.hpp"
+#include "utilities/petscError.hpp"
+
+using namespace ablate;
+
+/**
+ * Times the interpolation of a flow velocity field to the particle locations (point location + evaluation) as done by the particles each rhs evaluation.
+ * The arguments are the number of faces in each direction and the number of particles.
+ */
+static void BM_ParticleInterpolation(benchmark::State& state) {
+    const int faces = (int)state.range(0);
+    const PetscInt numberParticles = (PetscInt)state.range(1);
+    const PetscInt dim = 2;
+
+    auto mesh = std::make_shared<mesh::BoxMesh>("benchmarkMesh", std::vector<int>{faces, faces}, std::vector<double>{0.0, 0.0}, std::vector<double>{1.0, 1.0}, std::vector<std::string>{}, false);
+    DM dm = mesh->GetDomain();
+
+    // setup a linear velocity field like the incompressible flow
+    PetscFE fe;
+    PetscFECreateDefault(PetscObjectComm((PetscObject)dm), dim, dim, PETSC_FALSE, NULL, PETSC_DEFAULT, &fe) >> checkError;
+    DMSetField(dm, 0, NULL, (PetscObject)fe) >> checkError;
+    DMCreateDS(dm) >> checkError;
+    PetscFEDestroy(&fe) >> checkError;
+
+    Vec localVelocity;
+    DMCreateLocalVector(dm, &localVelocity) >> checkError;
+    PetscRandom random;
+    PetscRandomCreate(PETSC_COMM_SELF, &random) >> checkError;
+    PetscRandomSetSeed(random, 0) >> checkError;
+    PetscRandomSeed(random) >> checkError;
+    VecSetRandom(localVelocity, random) >> checkError;
+
+    // place the particles reproducibly within the domain
+    std::vector<PetscReal> coordinates(numberParticles * dim);
+    for (auto& coordinate : coordinates) {
+        PetscRandomGetValueReal(random, &coordinate) >> checkError;
+    }
+
+    for (auto _ : state) {
+        DMInterpolationInfo interpolationInfo;
+        DMInterpolationCreate(PETSC_COMM_SELF, &interpolationInfo) >> checkError;
+        DMInterpolationSetDim(interpolationInfo, dim) >> checkError;
+        DMInterpolationSetDof(interpolationInfo, dim) >> checkError;
+        DMInterpolationAddPoints(interpolationInfo, numberParticles, &coordinates[0]) >> checkError;
+        DMInterpolationSetUp(interpolationInfo, dm, PETSC_FALSE, PETSC_TRUE) >> checkError;
+
+        Vec particleVelocity;
+        DMInterpolationGetVector(interpolationInfo, &particleVelocity) >> checkError;
+        DMInterpolationEvaluate(interpolationInfo, dm, localVelocity, particleVelocity) >> checkError;
+        DMInterpolationRestoreVector(interpolationInfo, &particleVelocity) >> checkError;
+        DMInterpolationDestroy(&interpolationInfo) >> checkError;
+    }
+
+    state.counters["particles/s"] = benchmark::Counter((double)numberParticles, benchmark::Counter::kIsIterationInvariantRate);
+
+    PetscRandomDestroy(&random) >> checkError;
+    VecDestroy(&localVelocity) >> checkError;
+}
+BENCHMARK(BM_ParticleInterpolation)->ArgsProduct({{32, 128}, {1000, 10000}})->ArgNames({"faces", "particles"})->Unit(benchmark::kMillisecond);
+
+/**
+ * Times only the evaluation of the velocity at previously located particles with the particles stored in random or cell (Hilbert) order, as done when the
+ * particles are sorted every n steps.  The arguments are the number of faces in each direction, the number of particles, and if the particles are sorted.
+ */
+static void BM_ParticleInterpolationEvaluate(benchmark::State& state) {
+    const int faces = (int)state.range(0);
+    const PetscInt numberParticles = (PetscInt)state.range(1);
+    const bool sorted = state.range(2);
+    const PetscInt dim = 2;
+
+    auto mesh = std::make_shared<mesh::BoxMesh>("benchmarkMesh", std::vector<int>{faces, faces}, std::vector<double>{0.0, 0.0}, std::vector<double>{1.0, 1.0}, std::vector<std::string>{}, false);
+    DM dm = mesh->GetDomain();
+
+    // setup a linear velocity field like the incompressible flow
+    PetscFE fe;
+    PetscFECreateDefault(PetscObjectComm((PetscObject)dm), dim, dim, PETSC_FALSE, NULL, PETSC_DEFAULT, &fe) >> checkError;
+    DMSetField(dm, 0, NULL, (PetscObject)fe) >> checkError;
+    DMCreateDS(dm) >> checkError;
+    PetscFEDestroy(&fe) >> checkError;
+
+    Vec localVelocity;
+    DMCreateLocalVector(dm, &localVelocity) >> checkError;
+    PetscRandom random;
+    PetscRandomCreate(PETSC_COMM_SELF, &random) >> checkError;
+    PetscRandomSetSeed(random, 0) >> checkError;
+    PetscRandomSeed(random) >> checkError;
+    VecSetRandom(localVelocity, random) >> checkError;
+
+    // place the particles reproducibly within the domain
+    std::vector<PetscReal> coordinates(numberParticles * dim);
+    for (auto& coordinate : coordinates) {
+        PetscRandomGetValueReal(random, &coordinate) >> checkError;
+    }
+
+    // reorder the particles by cell like Particles::SortParticles
+    if (sorted) {
+        Vec pointVec;
+        VecCreateSeqWithArray(PETSC_COMM_SELF, dim, numberParticles * dim, &coordinates[0], &pointVec) >> checkError;
+        PetscSF cellSF = NULL;
+        DMLocatePoints(dm, pointVec, DM_POINTLOCATION_NONE, &cellSF) >> checkError;
+        const PetscSFNode* cells;
+        PetscSFGetGraph(cellSF, NULL, NULL, NULL, &cells) >> checkError;
+
+        PetscInt cStart, cEnd;
+        DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> checkError;
+        auto cellOrder = utilities::HilbertOrder::ComputeCellOrder(dm, cStart, cEnd);
+        std::vector<PetscInt> offsets(cEnd - cStart + 1, 0);
+        for (PetscInt p = 0; p < numberParticles; ++p) {
+            offsets[cellOrder[cells[p].index - cStart] + 1]++;
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        std::vector<PetscReal> sortedCoordinates(numberParticles * dim);
+        for (PetscInt p = 0; p < numberParticles; ++p) {
+            PetscInt s = offsets[cellOrder[cells[p].index - cStart]]++;
+            for (PetscInt d = 0; d < dim; ++d) {
+                sortedCoordinates[s * dim + d] = coordinates[p * dim + d];
+            }
+        }
+        coordinates = sortedCoordinates;
+
+        PetscSFDestroy(&cellSF) >> checkError;
+        VecDestroy(&pointVec) >> checkError;
+    }
+
+    DMInterpolationInfo interpolationInfo;
+    DMInterpolationCreate(PETSC_COMM_SELF, &interpolationInfo) >> checkError;
+    DMInterpolationSetDim(interpolationInfo, dim) >> checkError;
+    DMInterpolationSetDof(interpolationInfo, dim) >> checkError;
+    DMInterpolationAddPoints(interpolationInfo, numberParticles, &coordinates[0]) >> checkError;
+    DMInterpolationSetUp(interpolationInfo, dm, PETSC_FALSE, PETSC_TRUE) >> checkError;
+    Vec particleVelocity;
+    DMInterpolationGetVector(interpolationInfo, &particleVelocity) >> checkError;
+
+    for (auto _ : state) {
+        DMInterpolationEvaluate(interpolationInfo, dm, localVelocity, particleVelocity) >> checkError;
+    }
+
+    state.counters["particles/s"] = benchmark::Counter((double)numberParticles, benchmark::Counter::kIsIterationInvariantRate);
+
+    DMInterpolationRestoreVector(interpolationInfo, &particleVelocity) >> checkError;
+    DMInterpolationDestroy(&interpolationInfo) >> checkError;
+    PetscRandomDestroy(&random) >> checkError;
+    VecDestroy(&localVelocity) >> checkError;
+}
+BENCHMARK(BM_ParticleInterpolationEvaluate)->ArgsProduct({{32, 512}, {10000, 1000000}, {0, 1}})->ArgNames({"faces", "particles", "sorted"})->Unit(benchmark::kMillisecond);
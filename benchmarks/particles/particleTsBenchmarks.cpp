@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <petsc.h>
+#include "utilities/petscError.hpp"
+
+static PetscErrorCode DecayRHSFunction(TS, PetscReal, Vec u, Vec f, void*) {
+    PetscFunctionBeginUser;
+    PetscErrorCode ierr = VecAXPBY(f, -1.0, 0.0, u);
+    CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+}
+
+/**
+ * Times a particle like ts step when the number of local particles changes every step (as with migration or injection).  The ts is either reset with a new
+ * exactly sized solution each step, or integrated in a padded solution vector that only grows (and resets the ts) when the capacity is exceeded.
+ * The arguments are the number of particles and if the padded buffer is used.
+ */
+static void BM_ParticleTsChangingSize(benchmark::State& state) {
+    const PetscInt numberParticles = (PetscInt)state.range(0);
+    const bool padded = state.range(1);
+    const PetscInt components = 2;
+
+    TS ts;
+    TSCreate(PETSC_COMM_SELF, &ts) >> checkError;
+    TSSetType(ts, TSRK) >> checkError;
+    TSSetProblemType(ts, TS_NONLINEAR) >> checkError;
+    TSSetRHSFunction(ts, NULL, DecayRHSFunction, NULL) >> checkError;
+    TSSetExactFinalTime(ts, TS_EXACTFINALTIME_MATCHSTEP) >> checkError;
+    TSSetTimeStep(ts, 0.01) >> checkError;
+
+    // the padded buffer is sized with the same headroom as the particles
+    const PetscInt capacity = numberParticles + numberParticles / 4;
+    Vec buffer = NULL;
+    if (padded) {
+        VecCreateSeq(PETSC_COMM_SELF, capacity * components, &buffer) >> checkError;
+    }
+
+    PetscInt step = 0;
+    PetscInt resets = 0;
+    for (auto _ : state) {
+        // alternate the number of local particles each step
+        const PetscInt np = numberParticles - (step % 2);
+        PetscReal time = 0.0;
+        TSSetTime(ts, time) >> checkError;
+        TSSetMaxTime(ts, time + 0.01) >> checkError;
+        TSSetStepNumber(ts, 0) >> checkError;
+
+        if (padded) {
+            PetscScalar* array;
+            VecGetArrayWrite(buffer, &array) >> checkError;
+            for (PetscInt i = 0; i < capacity * components; ++i) {
+                array[i] = i < np * components ? 1.0 : 0.0;
+            }
+            VecRestoreArrayWrite(buffer, &array) >> checkError;
+            TSSolve(ts, buffer) >> checkError;
+        } else {
+            Vec solution;
+            VecCreateSeq(PETSC_COMM_SELF, np * components, &solution) >> checkError;
+            VecSet(solution, 1.0) >> checkError;
+            TSReset(ts) >> checkError;
+            resets++;
+            TSSolve(ts, solution) >> checkError;
+            VecDestroy(&solution) >> checkError;
+        }
+        step++;
+    }
+
+    state.counters["resets"] = benchmark::Counter((double)resets);
+    state.counters["particles/s"] = benchmark::Counter((double)numberParticles, benchmark::Counter::kIsIterationInvariantRate);
+
+    if (buffer) {
+        VecDestroy(&buffer) >> checkError;
+    }
+    TSDestroy(&ts) >> checkError;
+}
+BENCHMARK(BM_ParticleTsChangingSize)->ArgsProduct({{1000, 100000}, {0, 1}})->ArgNames({"particles", "padded"})->Unit(benchmark::kMillisecond);
@@ -22,6 +22,7 @@ if(CLANG_FORMAT AND Python_Interpreter_FOUND)
             ${PROJECT_SOURCE_DIR}/ablateCore
             ${PROJECT_SOURCE_DIR}/ablateLibrary
             ${PROJECT_SOURCE_DIR}/tests
+            ${PROJECT_SOURCE_DIR}/benchmarks
             COMMAND ${PROJECT_SOURCE_DIR}/extern/petscFormat/petscFormatTest.sh
             WORKING_DIRECTORY ${PROJECT_SOURCE_DIR}
             USES_TERMINAL
@@ -0,0 +1,153 @@
+#include <petsc.h>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <vector>
+#include "PetscTestFixture.hpp"
+#include "eos/perfectGas.hpp"
+#include "flow/boundaryConditions/characteristicGhost.hpp"
+#include "gtest/gtest.h"
+#include "parameters/mapParameters.hpp"
+
+using namespace ablate;
+
+typedef PetscErrorCode (*GhostUpdateFunction)(PetscReal time, const PetscReal* c, const PetscReal* n, const PetscScalar* a_xI, PetscScalar* a_xG, void* ctx);
+
+static const PetscReal specificHeatRatio = 1.4;
+
+struct PrimitiveState {
+    PetscReal density;
+    PetscReal velocity[2];
+    PetscReal pressure;
+};
+
+class CharacteristicGhostTestFixture : public testingResources::PetscTestFixture {
+   protected:
+    PetscDS ds = nullptr;
+
+    std::shared_ptr<eos::EOS> CreateEos(std::vector<std::string> species = {}) {
+        return std::make_shared<eos::PerfectGas>(std::make_shared<parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}, {"Rgas", "287.0"}}), species);
+    }
+
+    /**
+     * creates a 2D ds with the listed fv fields and sets up the boundary on the requested field
+     */
+    void SetupBoundary(flow::boundaryConditions::CharacteristicGhost& boundary, const std::vector<std::pair<std::string, PetscInt>>& fields, PetscInt boundaryField) {
+        PetscDSCreate(PETSC_COMM_SELF, &ds) >> errorChecker;
+        PetscDSSetCoordinateDimension(ds, 2) >> errorChecker;
+        for (std::size_t f = 0; f < fields.size(); f++) {
+            PetscFV fvm;
+            PetscFVCreate(PETSC_COMM_SELF, &fvm) >> errorChecker;
+            PetscObjectSetName((PetscObject)fvm, fields[f].first.c_str()) >> errorChecker;
+            PetscFVSetNumComponents(fvm, fields[f].second) >> errorChecker;
+            PetscFVSetSpatialDimension(fvm, 2) >> errorChecker;
+            PetscDSSetDiscretization(ds, f, (PetscObject)fvm) >> errorChecker;
+            PetscFVDestroy(&fvm) >> errorChecker;
+        }
+        boundary.SetupBoundary(ds, boundaryField);
+    }
+
+    void ComputeGhost(const PrimitiveState& interior, const PetscReal normal[2], PrimitiveState& ghost) {
+        // get the update function back from the ds
+        void (*function)(void);
+        void* context;
+        PetscDSGetBoundary(ds, 0, NULL, NULL, NULL, NULL, NULL, NULL, &function, NULL, NULL, NULL, &context) >> errorChecker;
+
+        PetscScalar eulerInterior[4];
+        eulerInterior[0] = interior.density;
+        eulerInterior[1] = interior.pressure / (specificHeatRatio - 1.0) + 0.5 * interior.density * (interior.velocity[0] * interior.velocity[0] + interior.velocity[1] * interior.velocity[1]);
+        eulerInterior[2] = interior.density * interior.velocity[0];
+        eulerInterior[3] = interior.density * interior.velocity[1];
+        PetscScalar eulerGhost[4] = {0.0, 0.0, 0.0, 0.0};
+        PetscReal centroid[2] = {0.0, 0.0};
+        ((GhostUpdateFunction)function)(0.0, centroid, normal, eulerInterior, eulerGhost, context) >> errorChecker;
+
+        ghost.density = eulerGhost[0];
+        ghost.velocity[0] = eulerGhost[2] / eulerGhost[0];
+        ghost.velocity[1] = eulerGhost[3] / eulerGhost[0];
+        ghost.pressure = (specificHeatRatio - 1.0) * (eulerGhost[1] - 0.5 * ghost.density * (ghost.velocity[0] * ghost.velocity[0] + ghost.velocity[1] * ghost.velocity[1]));
+    }
+
+    void TearDown() override {
+        if (ds) {
+            PetscDSDestroy(&ds) >> errorChecker;
+        }
+    }
+};
+
+TEST_F(CharacteristicGhostTestFixture, ShouldNotReflectWavesWithoutRelaxation) {
+    // arrange
+    flow::boundaryConditions::CharacteristicGhost boundary("outlet", {1}, CreateEos(), 90000.0, {}, 0.0, 0.0);
+    SetupBoundary(boundary, {{"euler", 4}}, 0);
+    PrimitiveState interior{.density = 1.2, .velocity = {0.0, 0.0}, .pressure = 101325.0};
+    PetscReal normal[2] = {0.0, -0.25};
+
+    // act
+    PrimitiveState ghost;
+    ComputeGhost(interior, normal, ghost);
+
+    // assert - with sigma 0 nothing enters the domain, so the ghost matches the interior
+    ASSERT_NEAR(interior.density, ghost.density, 1E-10);
+    ASSERT_NEAR(interior.velocity[0], ghost.velocity[0], 1E-8);
+    ASSERT_NEAR(interior.velocity[1], ghost.velocity[1], 1E-8);
+    ASSERT_NEAR(interior.pressure, ghost.pressure, 1E-6);
+}
+
+TEST_F(CharacteristicGhostTestFixture, ShouldRelaxIncomingWaveForSubsonicOutflow) {
+    // arrange
+    const PetscReal referencePressure = 90000.0;
+    flow::boundaryConditions::CharacteristicGhost boundary("outlet", {1}, CreateEos(), referencePressure, {}, 0.0, 1.0);
+    SetupBoundary(boundary, {{"euler", 4}}, 0);
+    PrimitiveState interior{.density = 1.2, .velocity = {50.0, 10.0}, .pressure = 101325.0};
+    PetscReal normal[2] = {0.5, 0.0};
+
+    // act
+    PrimitiveState ghost;
+    ComputeGhost(interior, normal, ghost);
+
+    // assert - the outgoing waves are extrapolated and the incoming acoustic wave takes the reference pressure
+    const PetscReal a = PetscSqrtReal(specificHeatRatio * interior.pressure / interior.density);
+    const PetscReal rhoA = interior.density * a;
+    const PetscReal un = interior.velocity[0];
+    const PetscReal ghostUn = ghost.velocity[0];
+    ASSERT_NEAR(referencePressure - rhoA * un, ghost.pressure - rhoA * ghostUn, 1E-6) << "w1 should be the reference wave";
+    ASSERT_NEAR(interior.pressure + rhoA * un, ghost.pressure + rhoA * ghostUn, 1E-6) << "w4 should be extrapolated";
+    ASSERT_NEAR(interior.density - interior.pressure / (a * a), ghost.density - ghost.pressure / (a * a), 1E-10) << "the entropy wave should be extrapolated";
+    ASSERT_NEAR(interior.velocity[1], ghost.velocity[1], 1E-8) << "the tangential velocity should be extrapolated";
+}
+
+TEST_F(CharacteristicGhostTestFixture, ShouldImposeReferenceStateForSupersonicInflow) {
+    // arrange
+    flow::boundaryConditions::CharacteristicGhost boundary("inlet", {1}, CreateEos(), 100000.0, {-450.0, 0.0}, 1.0, 0.0);
+    SetupBoundary(boundary, {{"euler", 4}}, 0);
+    PrimitiveState interior{.density = 1.2, .velocity = {-500.0, 5.0}, .pressure = 101325.0};
+    PetscReal normal[2] = {1.0, 0.0};
+
+    // act
+    PrimitiveState ghost;
+    ComputeGhost(interior, normal, ghost);
+
+    // assert - every wave enters the domain, so the ghost is the reference state
+    ASSERT_NEAR(1.0, ghost.density, 1E-10);
+    ASSERT_NEAR(-450.0, ghost.velocity[0], 1E-8);
+    ASSERT_NEAR(0.0, ghost.velocity[1], 1E-8);
+    ASSERT_NEAR(100000.0, ghost.pressure, 1E-6);
+}
+
+TEST_F(CharacteristicGhostTestFixture, ShouldFindDensityYiFieldFromDs) {
+    // arrange
+    flow::boundaryConditions::CharacteristicGhost boundary("outlet", {1}, CreateEos({"N2", "O2"}), 90000.0);
+
+    // act
+    // assert - the densityYi field does not need to follow the euler field
+    ASSERT_NO_THROW(SetupBoundary(boundary, {{"densityYi", 2}, {"euler", 4}}, 1));
+}
+
+TEST_F(CharacteristicGhostTestFixture, ShouldRequireDensityYiFieldWithSpecies) {
+    // arrange
+    flow::boundaryConditions::CharacteristicGhost boundary("outlet", {1}, CreateEos({"N2", "O2"}), 90000.0);
+
+    // act
+    // assert
+    ASSERT_THROW(SetupBoundary(boundary, {{"euler", 4}}, 0), std::invalid_argument);
+}
@@ -0,0 +1,167 @@
+#include <petsc.h>
+#include <memory>
+#include <vector>
+#include "PetscTestFixture.hpp"
+#include "flow/boundaryConditions/essentialGhost.hpp"
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+
+using namespace ablate;
+
+typedef PetscErrorCode (*GhostUpdateFunction)(PetscReal time, const PetscReal* c, const PetscReal* n, const PetscScalar* a_xI, PetscScalar* a_xG, void* ctx);
+
+class EssentialGhostTestFixture : public testingResources::PetscTestFixture {
+   protected:
+    DM dm = nullptr;
+
+    /**
+     * creates a 2D mesh with ghost cells on every boundary face (labeled boundary 1) and a two component fv field
+     */
+    void CreateMesh() {
+        DM baseDM;
+        PetscInt faces[2] = {3, 2};
+        PetscReal lower[2] = {0.0, 0.0};
+        PetscReal upper[2] = {1.0, 1.0};
+        DMPlexCreateBoxMesh(PETSC_COMM_SELF, 2, PETSC_FALSE, faces, lower, upper, NULL, PETSC_TRUE, &baseDM) >> errorChecker;
+        DMCreateLabel(baseDM, "boundary") >> errorChecker;
+        DMLabel boundaryLabel;
+        DMGetLabel(baseDM, "boundary", &boundaryLabel) >> errorChecker;
+        DMPlexMarkBoundaryFaces(baseDM, 1, boundaryLabel) >> errorChecker;
+        DMPlexConstructGhostCells(baseDM, "boundary", NULL, &dm) >> errorChecker;
+        DMDestroy(&baseDM) >> errorChecker;
+
+        PetscFV fvm;
+        PetscFVCreate(PETSC_COMM_SELF, &fvm) >> errorChecker;
+        PetscObjectSetName((PetscObject)fvm, "euler") >> errorChecker;
+        PetscFVSetNumComponents(fvm, 2) >> errorChecker;
+        PetscFVSetSpatialDimension(fvm, 2) >> errorChecker;
+        DMAddField(dm, NULL, (PetscObject)fvm) >> errorChecker;
+        PetscFVDestroy(&fvm) >> errorChecker;
+        DMCreateDS(dm) >> errorChecker;
+    }
+
+    /**
+     * returns the ghost values computed for each boundary face in the same way as DMPlexInsertBoundaryValues
+     */
+    std::vector<PetscScalar> ComputeGhostValues(PetscInt boundaryIndex, PetscReal time) {
+        PetscDS ds;
+        DMGetDS(dm, &ds) >> errorChecker;
+        void (*function)(void);
+        void* context;
+        PetscDSGetBoundary(ds, boundaryIndex, NULL, NULL, NULL, NULL, NULL, NULL, &function, NULL, NULL, NULL, &context) >> errorChecker;
+
+        Vec faceGeometry;
+        DMPlexGetGeometryFVM(dm, &faceGeometry, NULL, NULL) >> errorChecker;
+        DM faceDM;
+        VecGetDM(faceGeometry, &faceDM) >> errorChecker;
+        const PetscScalar* faceGeometryArray;
+        VecGetArrayRead(faceGeometry, &faceGeometryArray) >> errorChecker;
+
+        DMLabel boundaryLabel;
+        DMGetLabel(dm, "boundary", &boundaryLabel) >> errorChecker;
+        IS faceIS;
+        DMLabelGetStratumIS(boundaryLabel, 1, &faceIS) >> errorChecker;
+        PetscInt numberFaces;
+        const PetscInt* faces;
+        ISGetLocalSize(faceIS, &numberFaces) >> errorChecker;
+        ISGetIndices(faceIS, &faces) >> errorChecker;
+
+        std::vector<PetscScalar> ghostValues(2 * numberFaces);
+        for (PetscInt f = 0; f < numberFaces; ++f) {
+            PetscFVFaceGeom* faceGeom;
+            DMPlexPointLocalRead(faceDM, faces[f], faceGeometryArray, &faceGeom) >> errorChecker;
+            PetscScalar interior[2] = {0.0, 0.0};
+            ((GhostUpdateFunction)function)(time, faceGeom->centroid, faceGeom->normal, interior, &ghostValues[2 * f], context) >> errorChecker;
+        }
+
+        ISRestoreIndices(faceIS, &faces) >> errorChecker;
+        ISDestroy(&faceIS) >> errorChecker;
+        VecRestoreArrayRead(faceGeometry, &faceGeometryArray) >> errorChecker;
+        return ghostValues;
+    }
+
+    void TearDown() override {
+        if (dm) {
+            DMDestroy(&dm) >> errorChecker;
+        }
+    }
+};
+
+TEST_F(EssentialGhostTestFixture, ShouldMatchUncachedGhostValues) {
+    // arrange
+    CreateMesh();
+    auto boundaryFunction = std::make_shared<mathFunctions::FieldFunction>("euler", mathFunctions::Create("x + 2*y + t, x*y - t"));
+    flow::boundaryConditions::EssentialGhost uncachedBoundary("uncached", {1}, boundaryFunction, "boundary", false);
+    flow::boundaryConditions::EssentialGhost cachedBoundary("cached", {1}, boundaryFunction, "boundary", true);
+    PetscDS ds;
+    DMGetDS(dm, &ds) >> errorChecker;
+    uncachedBoundary.SetupBoundary(ds, 0);
+    cachedBoundary.SetupBoundary(ds, 0);
+    uncachedBoundary.UpdateDomain(dm);
+    cachedBoundary.UpdateDomain(dm);
+
+    // act
+    auto uncachedValues = ComputeGhostValues(0, 0.0);
+    auto cachedValues = ComputeGhostValues(1, 0.0);
+    auto reusedValues = ComputeGhostValues(1, 1.0);
+
+    // assert - the cached values match the direct evaluation, and are reused for later updates
+    ASSERT_EQ(uncachedValues.size(), cachedValues.size());
+    for (std::size_t i = 0; i < uncachedValues.size(); i++) {
+        ASSERT_DOUBLE_EQ(uncachedValues[i], cachedValues[i]) << "at index " << i;
+        ASSERT_DOUBLE_EQ(uncachedValues[i], reusedValues[i]) << "at index " << i;
+    }
+}
+
+TEST_F(EssentialGhostTestFixture, ShouldRebuildCacheWhenDomainChanges) {
+    // arrange
+    CreateMesh();
+    auto boundaryFunction = std::make_shared<mathFunctions::FieldFunction>("euler", mathFunctions::Create("x + 2*y + t, x*y - t"));
+    flow::boundaryConditions::EssentialGhost uncachedBoundary("uncached", {1}, boundaryFunction, "boundary", false);
+    flow::boundaryConditions::EssentialGhost cachedBoundary("cached", {1}, boundaryFunction, "boundary", true);
+    PetscDS ds;
+    DMGetDS(dm, &ds) >> errorChecker;
+    uncachedBoundary.SetupBoundary(ds, 0);
+    cachedBoundary.SetupBoundary(ds, 0);
+    uncachedBoundary.UpdateDomain(dm);
+    cachedBoundary.UpdateDomain(dm);
+    ComputeGhostValues(1, 0.0);
+
+    // act
+    cachedBoundary.UpdateDomain(dm);
+    auto cachedValues = ComputeGhostValues(1, 1.0);
+    auto uncachedValues = ComputeGhostValues(0, 1.0);
+
+    // assert - the values are recomputed after the update
+    ASSERT_EQ(uncachedValues.size(), cachedValues.size());
+    for (std::size_t i = 0; i < uncachedValues.size(); i++) {
+        ASSERT_DOUBLE_EQ(uncachedValues[i], cachedValues[i]) << "at index " << i;
+    }
+}
+
+TEST_F(EssentialGhostTestFixture, ShouldFindCachedFaceFromCopiedCentroid) {
+    // arrange
+    CreateMesh();
+    auto boundaryFunction = std::make_shared<mathFunctions::FieldFunction>("euler", mathFunctions::Create("x + 2*y + t, x*y - t"));
+    flow::boundaryConditions::EssentialGhost cachedBoundary("cached", {1}, boundaryFunction, "boundary", true);
+    PetscDS ds;
+    DMGetDS(dm, &ds) >> errorChecker;
+    cachedBoundary.SetupBoundary(ds, 0);
+    cachedBoundary.UpdateDomain(dm);
+    ComputeGhostValues(0, 0.0);
+
+    void (*function)(void);
+    void* context;
+    PetscDSGetBoundary(ds, 0, NULL, NULL, NULL, NULL, NULL, NULL, &function, NULL, NULL, NULL, &context) >> errorChecker;
+
+    // act - the centroid of the bottom left boundary face is not a pointer into the face geometry
+    const PetscReal centroid[3] = {1.0 / 6.0, 0.0, 0.0};
+    const PetscReal normal[3] = {0.0, -1.0 / 3.0, 0.0};
+    PetscScalar interior[2] = {0.0, 0.0};
+    PetscScalar ghost[2];
+    ((GhostUpdateFunction)function)(1.0, centroid, normal, interior, ghost, context) >> errorChecker;
+
+    // assert - the cached time zero value is used
+    ASSERT_DOUBLE_EQ(1.0 / 6.0, ghost[0]);
+    ASSERT_DOUBLE_EQ(0.0, ghost[1]);
+}
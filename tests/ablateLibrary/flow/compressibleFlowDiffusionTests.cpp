@@ -34,6 +34,7 @@ struct CompressibleFlowDiffusionTestParameters {
     int levels;
     std::vector<PetscReal> expectedL2Convergence;
     std::vector<PetscReal> expectedLInfConvergence;
+    bool implicitDiffusion;
 };
 
 using namespace ablate;
@@ -205,7 +206,7 @@ TEST_P(CompressibleFlowDiffusionTestFixture, ShouldConvergeToExactSolution) {
             auto eos = std::make_shared<ablate::eos::PerfectGas>(
                 std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", std::to_string(parameters.gamma)}, {"Rgas", std::to_string(parameters.Rgas)}}));
 
-            auto flowParameters = std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"cfl", "0.5"}});
+            auto flowParameters = std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"cfl", "0.5"}, {"implicitDiffusion", GetParam().implicitDiffusion ? "true" : "false"}});
 
             auto transportModel = std::make_shared<ablate::eos::transport::Constant>(parameters.k);
 
@@ -238,6 +239,11 @@ TEST_P(CompressibleFlowDiffusionTestFixture, ShouldConvergeToExactSolution) {
             // advance to the end time
             TSSolve(ts, flowObject->GetSolutionVector()) >> testErrorChecker;
 
+            // the implicit solve must converge for each step
+            TSConvergedReason reason;
+            TSGetConvergedReason(ts, &reason) >> testErrorChecker;
+            ASSERT_GT(reason, 0) << "the ts did not converge";
+
             // Get the L2 and LInf norms
             std::vector<PetscReal> l2Norm;
             std::vector<PetscReal> lInfNorm;
@@ -310,7 +316,29 @@ INSTANTIATE_TEST_SUITE_P(
                                                               .initialNx = 9,
                                                               .levels = 2,
                                                               .expectedL2Convergence = {NAN, 2.2, NAN, NAN},
-                                                              .expectedLInfConvergence = {NAN, 2.5, NAN, NAN}}),
+                                                              .expectedLInfConvergence = {NAN, 2.5, NAN, NAN}},
+                    (CompressibleFlowDiffusionTestParameters){.mpiTestParameter = {.testName = "implicit conduction",
+                                                                                   .nproc = 1,
+                                                                                   .arguments = "-dm_plex_separate_marker -petsclimiter_type none -ts_adapt_type none -automaticTimeStepCalculator off "
+                                                                                                "-Tpetscfv_type leastsquares -velpetscfv_type leastsquares -ts_max_steps 600 -ts_dt 0.00000625 "
+                                                                                                "-ts_type beuler -snes_rtol 1E-10 -ksp_rtol 1E-8 -ts_max_snes_failures 1"},
+                                                              .parameters = {.dim = 2, .L = 0.1, .gamma = 1.4, .Rgas = 1.0, .k = 0.3, .rho = 1.0, .Tinit = 400, .Tboundary = 300},
+                                                              .initialNx = 3,
+                                                              .levels = 3,
+                                                              .expectedL2Convergence = {NAN, 1.5, NAN, NAN},
+                                                              .expectedLInfConvergence = {NAN, 1.3, NAN, NAN},
+                                                              .implicitDiffusion = true},
+                    (CompressibleFlowDiffusionTestParameters){.mpiTestParameter = {.testName = "implicit conduction multi mpi",
+                                                                                   .nproc = 2,
+                                                                                   .arguments = "-dm_plex_separate_marker -petsclimiter_type none -ts_adapt_type none -automaticTimeStepCalculator off "
+                                                                                                "-Tpetscfv_type leastsquares -velpetscfv_type leastsquares -ts_max_steps 600 -ts_dt 0.00000625 "
+                                                                                                "-ts_type beuler -snes_rtol 1E-10 -ksp_rtol 1E-8 -ts_max_snes_failures 1"},
+                                                              .parameters = {.dim = 2, .L = 0.1, .gamma = 1.4, .Rgas = 1.0, .k = 0.3, .rho = 1.0, .Tinit = 400, .Tboundary = 300},
+                                                              .initialNx = 9,
+                                                              .levels = 2,
+                                                              .expectedL2Convergence = {NAN, 2.2, NAN, NAN},
+                                                              .expectedLInfConvergence = {NAN, 2.5, NAN, NAN},
+                                                              .implicitDiffusion = true}),
     [](const testing::TestParamInfo<CompressibleFlowDiffusionTestParameters> &info) { return info.param.mpiTestParameter.getTestName(); });
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
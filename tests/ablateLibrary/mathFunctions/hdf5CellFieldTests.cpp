@@ -0,0 +1,110 @@
+#include <petsc.h>
+#include <petscviewerhdf5.h>
+#include <PetscTestFixture.hpp>
+#include <filesystem>
+#include <vector>
+#include "gtest/gtest.h"
+#include "mathFunctions/hdf5CellField.hpp"
+
+class Hdf5CellFieldTestFixture : public testingResources::PetscTestFixture {
+   protected:
+    std::filesystem::path file = std::filesystem::temp_directory_path() / "hdf5CellFieldTest.hdf5";
+
+    // the saved value of each component at each output
+    static PetscReal ExpectedValue(const PetscReal centroid[2], PetscInt output, PetscInt component) { return (output + 1.0) * (centroid[0] + 2.0 * centroid[1]) + component; }
+
+    /**
+     * writes two outputs of a two component cell field on a 4x3 mesh in the same layout as the Hdf5Monitor
+     */
+    void WriteHdf5File() {
+        DM dm;
+        PetscInt faces[2] = {4, 3};
+        PetscReal lower[2] = {0.0, 0.0};
+        PetscReal upper[2] = {1.0, 1.0};
+        DMPlexCreateBoxMesh(PETSC_COMM_SELF, 2, PETSC_FALSE, faces, lower, upper, NULL, PETSC_TRUE, &dm) >> errorChecker;
+        PetscObjectSetName((PetscObject)dm, "testMesh") >> errorChecker;
+
+        PetscFV fvm;
+        PetscFVCreate(PETSC_COMM_SELF, &fvm) >> errorChecker;
+        PetscObjectSetName((PetscObject)fvm, "value") >> errorChecker;
+        PetscFVSetNumComponents(fvm, 2) >> errorChecker;
+        PetscFVSetSpatialDimension(fvm, 2) >> errorChecker;
+        DMAddField(dm, NULL, (PetscObject)fvm) >> errorChecker;
+        PetscFVDestroy(&fvm) >> errorChecker;
+        DMCreateDS(dm) >> errorChecker;
+
+        Vec solution;
+        DMCreateGlobalVector(dm, &solution) >> errorChecker;
+        PetscObjectSetName((PetscObject)solution, "solution") >> errorChecker;
+
+        PetscViewer viewer;
+        PetscViewerHDF5Open(PETSC_COMM_SELF, file.string().c_str(), FILE_MODE_WRITE, &viewer) >> errorChecker;
+        DMView(dm, viewer) >> errorChecker;
+
+        PetscInt cStart, cEnd;
+        DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> errorChecker;
+        for (PetscInt output = 0; output < 2; output++) {
+            PetscScalar* solutionArray;
+            VecGetArray(solution, &solutionArray) >> errorChecker;
+            for (PetscInt c = cStart; c < cEnd; c++) {
+                PetscReal centroid[3];
+                DMPlexComputeCellGeometryFVM(dm, c, NULL, centroid, NULL) >> errorChecker;
+                PetscScalar* cellValues;
+                DMPlexPointGlobalRef(dm, c, solutionArray, &cellValues) >> errorChecker;
+                for (PetscInt component = 0; component < 2; component++) {
+                    cellValues[component] = ExpectedValue(centroid, output, component);
+                }
+            }
+            VecRestoreArray(solution, &solutionArray) >> errorChecker;
+
+            DMSetOutputSequenceNumber(dm, output, 0.1 * output) >> errorChecker;
+            VecView(solution, viewer) >> errorChecker;
+        }
+
+        PetscViewerDestroy(&viewer) >> errorChecker;
+        VecDestroy(&solution) >> errorChecker;
+        DMDestroy(&dm) >> errorChecker;
+    }
+
+    void TearDown() override { std::filesystem::remove(file); }
+};
+
+TEST_F(Hdf5CellFieldTestFixture, ShouldEvaluateSavedCellValues) {
+    // arrange
+    WriteHdf5File();
+    ablate::mathFunctions::Hdf5CellField lastOutput(file, "solution_value");
+    ablate::mathFunctions::Hdf5CellField firstOutput(file, "solution_value", 1);
+
+    // act
+    // assert - any point in a cell returns the value saved for that cell
+    for (PetscInt i = 0; i < 4; i++) {
+        for (PetscInt j = 0; j < 3; j++) {
+            const PetscReal centroid[2] = {(i + 0.5) / 4.0, (j + 0.5) / 3.0};
+            const double point[2] = {centroid[0] + 0.1 / 4.0, centroid[1] - 0.1 / 3.0};
+
+            std::vector<double> result(2);
+            lastOutput.Eval(point, 2, 0.0, result);
+            ASSERT_NEAR(ExpectedValue(centroid, 1, 0), result[0], 1E-12);
+            ASSERT_NEAR(ExpectedValue(centroid, 1, 1), result[1], 1E-12);
+            ASSERT_NEAR(ExpectedValue(centroid, 0, 0), firstOutput.Eval(point, 2, 0.0), 1E-12);
+
+            PetscScalar petscResult[2];
+            auto function = firstOutput.GetPetscFunction();
+            function(2, 0.0, point, 2, petscResult, firstOutput.GetContext()) >> errorChecker;
+            ASSERT_NEAR(ExpectedValue(centroid, 0, 1), petscResult[1], 1E-12);
+        }
+    }
+}
+
+TEST_F(Hdf5CellFieldTestFixture, ShouldUseNearestCellForPointsJustOutsideTheMesh) {
+    // arrange
+    WriteHdf5File();
+    ablate::mathFunctions::Hdf5CellField field(file, "solution_value");
+    const PetscReal cornerCentroid[2] = {3.5 / 4.0, 2.5 / 3.0};
+
+    // act
+    auto value = field.Eval(1.0 + 1E-10, 1.0 + 1E-10, 0.0, 0.0);
+
+    // assert
+    ASSERT_NEAR(ExpectedValue(cornerCentroid, 1, 0), value, 1E-12);
+}
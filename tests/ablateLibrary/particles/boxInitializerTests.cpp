@@ -0,0 +1,123 @@
+#include <petsc.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "MpiTestFixture.hpp"
+#include "PetscTestErrorChecker.hpp"
+#include "gtest/gtest.h"
+#include "particles/initializers/boxInitializer.hpp"
+
+using namespace ablate;
+
+struct BoxInitializerParameters {
+    testingResources::MpiTestParameter mpiTestParameter;
+    PetscInt dim;
+    PetscInt faces;
+    std::vector<double> lower;
+    std::vector<double> upper;
+    int particlesPerDim;
+};
+
+class BoxInitializerTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<BoxInitializerParameters> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam().mpiTestParameter); }
+};
+
+TEST_P(BoxInitializerTestFixture, ShouldPlaceEachParticleOnExactlyOneRank) {
+    StartWithMPI
+        {
+            // arrange
+            PetscInitialize(argc, argv, NULL, NULL) >> testErrorChecker;
+            const auto &testingParam = GetParam();
+
+            // create a distributed mesh with overlap so that particles on partition faces can be located on several ranks
+            PetscInt faces[3] = {testingParam.faces, testingParam.faces, testingParam.faces};
+            PetscReal start[3] = {0.0, 0.0, 0.0};
+            PetscReal end[3] = {1.0, 1.0, 1.0};
+            DMBoundaryType bcType[3] = {DM_BOUNDARY_NONE, DM_BOUNDARY_NONE, DM_BOUNDARY_NONE};
+            DM dm;
+            DMPlexCreateBoxMesh(PETSC_COMM_WORLD, testingParam.dim, PETSC_FALSE, faces, start, end, bcType, PETSC_TRUE, &dm) >> testErrorChecker;
+            DM dmDist = NULL;
+            DMPlexDistribute(dm, 1, NULL, &dmDist) >> testErrorChecker;
+            if (dmDist) {
+                DMDestroy(&dm) >> testErrorChecker;
+                dm = dmDist;
+            }
+
+            auto initializer = std::make_shared<particles::initializers::BoxInitializer>(testingParam.lower, testingParam.upper, testingParam.particlesPerDim);
+
+            // act
+            std::vector<PetscReal> coordinates;
+            std::vector<PetscInt> cells;
+            std::vector<PetscInt> latticeIndices;
+            initializer->ComputeLocalBoxPoints(dm, coordinates, cells, latticeIndices);
+
+            // assert - gather the particle ids on the first rank and print them in order
+            PetscMPIInt rank, size;
+            MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> testErrorChecker;
+            MPI_Comm_size(PETSC_COMM_WORLD, &size) >> testErrorChecker;
+            PetscMPIInt localCount = latticeIndices.size();
+            std::vector<PetscMPIInt> counts(size), offsets(size, 0);
+            MPI_Gather(&localCount, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, PETSC_COMM_WORLD) >> testErrorChecker;
+            for (PetscMPIInt r = 1; r < size; ++r) {
+                offsets[r] = offsets[r - 1] + counts[r - 1];
+            }
+            std::vector<PetscInt> allIndices(offsets[size - 1] + counts[size - 1]);
+            MPI_Gatherv(latticeIndices.data(), localCount, MPIU_INT, allIndices.data(), counts.data(), offsets.data(), MPIU_INT, 0, PETSC_COMM_WORLD) >> testErrorChecker;
+
+            if (rank == 0) {
+                std::sort(allIndices.begin(), allIndices.end());
+                PetscPrintf(PETSC_COMM_SELF, "ParticleCount: %D\n", (PetscInt)allIndices.size()) >> testErrorChecker;
+                PetscPrintf(PETSC_COMM_SELF, "Pids:") >> testErrorChecker;
+                for (const auto &index : allIndices) {
+                    PetscPrintf(PETSC_COMM_SELF, " %D", index) >> testErrorChecker;
+                }
+                PetscPrintf(PETSC_COMM_SELF, "\n") >> testErrorChecker;
+            }
+
+            DMDestroy(&dm) >> testErrorChecker;
+        }
+        exit(PetscFinalize());
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParticleInitializerTests, BoxInitializerTestFixture,
+    testing::Values(
+        (BoxInitializerParameters){.mpiTestParameter = {.testName = "box initializer 2d single", .nproc = 1, .expectedOutputFile = "outputs/particles/boxInitializer_2d", .arguments = ""},
+                                   .dim = 2,
+                                   .faces = 4,
+                                   .lower = {0.25, 0.25},
+                                   .upper = {0.75, 0.75},
+                                   .particlesPerDim = 5},
+        (BoxInitializerParameters){.mpiTestParameter = {.testName = "box initializer 2d two ranks", .nproc = 2, .expectedOutputFile = "outputs/particles/boxInitializer_2d", .arguments = ""},
+                                   .dim = 2,
+                                   .faces = 4,
+                                   .lower = {0.25, 0.25},
+                                   .upper = {0.75, 0.75},
+                                   .particlesPerDim = 5},
+        (BoxInitializerParameters){.mpiTestParameter = {.testName = "box initializer 2d three ranks", .nproc = 3, .expectedOutputFile = "outputs/particles/boxInitializer_2d", .arguments = ""},
+                                   .dim = 2,
+                                   .faces = 4,
+                                   .lower = {0.25, 0.25},
+                                   .upper = {0.75, 0.75},
+                                   .particlesPerDim = 5},
+        (BoxInitializerParameters){.mpiTestParameter = {.testName = "box initializer 3d single", .nproc = 1, .expectedOutputFile = "outputs/particles/boxInitializer_3d", .arguments = ""},
+                                   .dim = 3,
+                                   .faces = 2,
+                                   .lower = {0.0, 0.0, 0.0},
+                                   .upper = {1.0, 1.0, 1.0},
+                                   .particlesPerDim = 3},
+        (BoxInitializerParameters){.mpiTestParameter = {.testName = "box initializer 3d two ranks", .nproc = 2, .expectedOutputFile = "outputs/particles/boxInitializer_3d", .arguments = ""},
+                                   .dim = 3,
+                                   .faces = 2,
+                                   .lower = {0.0, 0.0, 0.0},
+                                   .upper = {1.0, 1.0, 1.0},
+                                   .particlesPerDim = 3},
+        (BoxInitializerParameters){.mpiTestParameter = {.testName = "box initializer 3d three ranks", .nproc = 3, .expectedOutputFile = "outputs/particles/boxInitializer_3d", .arguments = ""},
+                                   .dim = 3,
+                                   .faces = 2,
+                                   .lower = {0.0, 0.0, 0.0},
+                                   .upper = {1.0, 1.0, 1.0},
+                                   .particlesPerDim = 3}),
+    [](const testing::TestParamInfo<BoxInitializerParameters> &info) { return info.param.mpiTestParameter.getTestName(); });
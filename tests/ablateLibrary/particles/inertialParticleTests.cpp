@@ -70,6 +70,7 @@ struct InertialParticleExactParameters {
     IntegrandTestFunction f0_q;
     ExactSolutionParameters parameters;
     std::shared_ptr<ablate::particles::initializers::Initializer> particleInitializer;
+    bool exponentialDrag = false;
 };
 
 class InertialParticleExactTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<InertialParticleExactParameters> {
@@ -187,6 +188,48 @@ static PetscErrorCode MonitorFlowAndParticleError(TS ts, PetscInt step, PetscRea
     PetscFunctionReturn(0);
 }
 
+struct StokesRelaxationMonitorContext {
+    ablate::particles::Inertial *particles;
+    ExactSolutionParameters *parameters;
+    std::vector<PetscReal> initialLocations;
+};
+
+static PetscErrorCode MonitorStokesRelaxationError(TS ts, PetscInt step, PetscReal crtime, Vec u, void *ctx) {
+    PetscErrorCode ierr;
+
+    PetscFunctionBeginUser;
+    StokesRelaxationMonitorContext *context = (StokesRelaxationMonitorContext *)ctx;
+    DM swarm = context->particles->GetDM();
+
+    PetscInt np;
+    ierr = DMSwarmGetLocalSize(swarm, &np);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+
+    // compare the particle location and velocity against the analytic relaxation from each initial location
+    const PetscReal *coords, *velocity;
+    PetscReal maxError = 0.0;
+    ierr = DMSwarmGetField(swarm, DMSwarmPICField_coor, NULL, NULL, (void **)&coords);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+    ierr = DMSwarmGetField(swarm, ablate::particles::Inertial::ParticleVelocity, NULL, NULL, (void **)&velocity);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+    for (PetscInt p = 0; p < np; p++) {
+        PetscScalar exact[4];
+        settling(2, crtime, &context->initialLocations[p * 2], 1, exact, context->parameters);
+        for (PetscInt n = 0; n < 2; n++) {
+            maxError = PetscMax(maxError, PetscAbsReal(coords[p * 2 + n] - exact[n]));
+            maxError = PetscMax(maxError, PetscAbsReal(velocity[p * 2 + n] - exact[2 + n]));
+        }
+    }
+    ierr = DMSwarmRestoreField(swarm, ablate::particles::Inertial::ParticleVelocity, NULL, NULL, (void **)&velocity);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+    ierr = DMSwarmRestoreField(swarm, DMSwarmPICField_coor, NULL, NULL, (void **)&coords);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+
+    ierr = PetscPrintf(PETSC_COMM_WORLD, "Stokes Relaxation Error: %2.3g\n", (double)maxError);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+    PetscFunctionReturn(0);
+}
+
 TEST_P(InertialParticleExactTestFixture, ParticleShouldMoveAsExpected) {
     StartWithMPI
         {
@@ -255,7 +298,8 @@ TEST_P(InertialParticleExactTestFixture, ParticleShouldMoveAsExpected) {
 
             auto particleParameters = std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"fluidDensity", std::to_string(testingParam.parameters.rhoF)},
                                                                                                                              {"fluidViscosity", std::to_string(testingParam.parameters.muF)},
-                                                                                                                             {"gravityField", std::to_string(testingParam.parameters.grav) + " 0 0"}});
+                                                                                                                             {"gravityField", std::to_string(testingParam.parameters.grav) + " 0 0"},
+                                                                                                                             {"exponentialDrag", testingParam.exponentialDrag ? "true" : "false"}});
 
             // convert the constant values to fieldInitializations
             auto fieldInitialization = std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{
@@ -271,8 +315,13 @@ TEST_P(InertialParticleExactTestFixture, ParticleShouldMoveAsExpected) {
             auto exactSolutionFunction = ablate::mathFunctions::Create(testingParam.particleExact, &testingParam.parameters);
 
             // Create an inertial particle object
-            auto particles =
-                std::make_shared<ablate::particles::Inertial>("particle", 2, particleParameters, GetParam().particleInitializer, fieldInitialization, exactSolutionFunction, particleOptions);
+            auto particles = std::make_shared<ablate::particles::Inertial>("particle",
+                                                                           2,
+                                                                           particleParameters,
+                                                                           GetParam().particleInitializer,
+                                                                           fieldInitialization,
+                                                                           exactSolutionFunction,
+                                                                           particleOptions);
 
             // link the flow to the particles
             particles->InitializeFlow(flowObject);
@@ -281,6 +330,18 @@ TEST_P(InertialParticleExactTestFixture, ParticleShouldMoveAsExpected) {
 
             // setup the flow monitor to also check particles
             TSMonitorSet(ts, MonitorFlowAndParticleError, particles.get(), NULL) >> testErrorChecker;
+
+            // the exponential drag step should follow the analytic relaxation in the quiescent fluid
+            StokesRelaxationMonitorContext stokesRelaxationContext{.particles = particles.get(), .parameters = &testingParam.parameters};
+            if (testingParam.exponentialDrag) {
+                const PetscReal *coords;
+                PetscInt np;
+                DMSwarmGetLocalSize(particles->GetDM(), &np) >> testErrorChecker;
+                DMSwarmGetField(particles->GetDM(), DMSwarmPICField_coor, NULL, NULL, (void **)&coords) >> testErrorChecker;
+                stokesRelaxationContext.initialLocations.assign(coords, coords + np * 2);
+                DMSwarmRestoreField(particles->GetDM(), DMSwarmPICField_coor, NULL, NULL, (void **)&coords) >> testErrorChecker;
+                TSMonitorSet(ts, MonitorStokesRelaxationError, &stokesRelaxationContext, NULL) >> testErrorChecker;
+            }
             TSSetFromOptions(ts) >> testErrorChecker;
 
             // Solve the one way coupled system
@@ -356,5 +417,26 @@ INSTANTIATE_TEST_SUITE_P(InertialParticleTests, InertialParticleExactTestFixture
                                                                            .f0_w = f0_quiescent_w,
                                                                            .parameters = {.dim = 2, .pVel = {0.0, 0.0}, .dp = 0.22, .rhoP = 90.0, .rhoF = 1.0, .muF = 1.0, .grav = 1.0},
                                                                            .particleInitializer = std::make_shared<ablate::particles::initializers::BoxInitializer>(std::vector<double>{0.92, 0.3},
-                                                                                                                                                                    std::vector<double>{.98, .6}, 10)}),
+                                                                                                                                                                    std::vector<double>{.98, .6}, 10)},
+                                         (InertialParticleExactParameters){
+                                             .mpiTestParameter = {.testName = "exponential drag inertial particles settling in quiescent fluid",
+                                                                  .nproc = 1,
+                                                                  .expectedOutputFile = "outputs/particles/inertialParticles_settling_in_quiescent_fluid_exponential_drag",
+                                                                  .arguments = "-dm_plex_separate_marker -dm_refine 2 "
+                                                                               "-vel_petscspace_degree 2 -pres_petscspace_degree 1 -temp_petscspace_degree 1 "
+                                                                               "-dmts_check .001 -ts_max_steps 7 -ts_dt 0.06 -ksp_type fgmres -ksp_gmres_restart 10 "
+                                                                               "-ksp_rtol 1.0e-9 -ksp_error_if_not_converged -pc_type fieldsplit  "
+                                                                               " -pc_fieldsplit_type schur -pc_fieldsplit_schur_factorization_type full "
+                                                                               "-particle_ts_convergence_estimate -convest_num_refine 1 "},
+                                             .uExact = quiescent_u,
+                                             .pExact = quiescent_p,
+                                             .TExact = quiescent_T,
+                                             .u_tExact = quiescent_u_t,
+                                             .T_tExact = quiescent_T_t,
+                                             .particleExact = settling,
+                                             .f0_v = f0_quiescent_v,
+                                             .f0_w = f0_quiescent_w,
+                                             .parameters = {.dim = 2, .pVel = {0.0, 0.0}, .dp = 0.22, .rhoP = 90.0, .rhoF = 1.0, .muF = 1.0, .grav = 1.0},
+                                             .particleInitializer = std::make_shared<ablate::particles::initializers::BoxInitializer>(std::vector<double>{0.2, 0.3}, std::vector<double>{.4, .6}, 10),
+                                             .exponentialDrag = true}),
                          [](const testing::TestParamInfo<InertialParticleExactParameters> &info) { return info.param.mpiTestParameter.getTestName(); });
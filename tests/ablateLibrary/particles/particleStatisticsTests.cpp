@@ -0,0 +1,48 @@
+#include <petsc.h>
+#include <SwarmTestFixture.hpp>
+#include <vector>
+#include "gtest/gtest.h"
+#include "particles/particleStatistics.hpp"
+
+class ParticleStatisticsTestFixture : public testingResources::SwarmTestFixture {};
+
+TEST_F(ParticleStatisticsTestFixture, ShouldComputeWeightedCellStatistics) {
+    // arrange - a two cell mesh
+    CreateCellDM({2, 1}, {0.0, 0.0}, {2.0, 1.0});
+
+    // the particles in the first cell have a large offset so that E[x^2] - E[x]^2 would lose all precision
+    const PetscReal offset = 1.0E8;
+    const std::vector<PetscInt> particleCells = {0, 0, 0, 1, 1};
+    const std::vector<PetscReal> particleWeights = {1.0, 2.0, 1.0, 1.0, 1.0};
+    const std::vector<PetscReal> particleValues = {offset + 1.0, offset + 2.0, offset + 4.0, 3.0, 5.0};
+    CreateSwarm(particleCells.size(), {{ablate::particles::Particles::ParticleWeight, 1}, {"value", 1}});
+    SetField(DMSwarmPICField_cellid, particleCells);
+    SetField(ablate::particles::Particles::ParticleWeight, particleWeights);
+    SetField("value", particleValues);
+
+    DM statisticsDM;
+    ablate::particles::ParticleStatistics::CreateStatisticsDM(swarm, cellDM, "statistics", {"value"}, &statisticsDM);
+    Vec statistics;
+    DMCreateGlobalVector(statisticsDM, &statistics) >> errorChecker;
+
+    // act
+    ablate::particles::ParticleStatistics::ComputeStatistics(swarm, statisticsDM, {"value"}, statistics);
+
+    // assert - each cell holds the count, mean, and variance
+    const PetscScalar* statisticsArray;
+    VecGetArrayRead(statistics, &statisticsArray) >> errorChecker;
+    const PetscScalar* cellStatistics;
+    DMPlexPointGlobalRead(statisticsDM, 0, statisticsArray, &cellStatistics) >> errorChecker;
+    ASSERT_DOUBLE_EQ(4.0, cellStatistics[0]);
+    ASSERT_DOUBLE_EQ(offset + 2.25, cellStatistics[1]);
+    ASSERT_NEAR(1.1875, cellStatistics[2], 1.0E-8);
+    DMPlexPointGlobalRead(statisticsDM, 1, statisticsArray, &cellStatistics) >> errorChecker;
+    ASSERT_DOUBLE_EQ(2.0, cellStatistics[0]);
+    ASSERT_DOUBLE_EQ(4.0, cellStatistics[1]);
+    ASSERT_DOUBLE_EQ(1.0, cellStatistics[2]);
+    VecRestoreArrayRead(statistics, &statisticsArray) >> errorChecker;
+
+    // cleanup
+    VecDestroy(&statistics) >> errorChecker;
+    DMDestroy(&statisticsDM) >> errorChecker;
+}
@@ -0,0 +1,22 @@
+#include <petsc.h>
+#include <SwarmTestFixture.hpp>
+#include <vector>
+#include "gtest/gtest.h"
+#include "particles/particles.hpp"
+
+class ParticleSubsampleTestFixture : public testingResources::SwarmTestFixture {};
+
+TEST_F(ParticleSubsampleTestFixture, ShouldSelectParticlesByPid) {
+    // arrange - the particles are stored out of id order, as they would be after migration
+    const std::vector<PetscInt64> pids = {7, 0, 3, 9, 6, 4, 12};
+    CreateSwarm(pids.size());
+    SetField(DMSwarmField_pid, pids);
+
+    // act
+    auto selected = ablate::particles::Particles::SelectSubsample(swarm, 3);
+    auto selectedAll = ablate::particles::Particles::SelectSubsample(swarm, 0);
+
+    // assert
+    ASSERT_EQ((std::vector<PetscInt>{1, 2, 3, 4, 6}), selected);
+    ASSERT_EQ(pids.size(), selectedAll.size());
+}
@@ -0,0 +1,59 @@
+#include <petsc.h>
+#include <SwarmTestFixture.hpp>
+#include <vector>
+#include "gtest/gtest.h"
+#include "particles/initializers/initializer.hpp"
+#include "particles/particles.hpp"
+
+class ParticleWeightTestFixture : public testingResources::SwarmTestFixture {
+   protected:
+    void CreateSwarm(PetscInt np) { SwarmTestFixture::CreateSwarm(np, {{ablate::particles::Particles::ParticleWeight, 1}, {"value", 2}}); }
+};
+
+// expose the parcel weight helper to the tests
+class TestInitializer : public ablate::particles::initializers::Initializer {
+   public:
+    using Initializer::SetParcelWeight;
+    void Initialize(ablate::flow::Flow&, DM) override {}
+};
+
+TEST_F(ParticleWeightTestFixture, ShouldComputeWeightedMean) {
+    // arrange
+    const std::vector<PetscReal> weights = {1.0, 2.0, 3.0};
+    const std::vector<PetscReal> values = {1.0, -1.0, 2.0, -2.0, 6.0, 0.0};
+    CreateSwarm(weights.size());
+
+    SetField(ablate::particles::Particles::ParticleWeight, weights);
+    SetField("value", values);
+
+    // act
+    auto totalWeight = ablate::particles::Particles::ComputeTotalWeight(swarm);
+    auto mean = ablate::particles::Particles::ComputeWeightedMean(swarm, "value");
+
+    // assert - each parcel counts as weight physical particles
+    ASSERT_DOUBLE_EQ(6.0, totalWeight);
+    ASSERT_EQ((std::size_t)2, mean.size());
+    ASSERT_DOUBLE_EQ((1.0 + 4.0 + 18.0) / 6.0, mean[0]);
+    ASSERT_DOUBLE_EQ((-1.0 - 4.0) / 6.0, mean[1]);
+}
+
+TEST_F(ParticleWeightTestFixture, ShouldSetParcelWeight) {
+    // arrange
+    CreateSwarm(4);
+
+    // act
+    TestInitializer::SetParcelWeight(swarm, 2.5);
+
+    // assert
+    ASSERT_DOUBLE_EQ(10.0, ablate::particles::Particles::ComputeTotalWeight(swarm));
+}
+
+TEST_F(ParticleWeightTestFixture, ShouldNotAllowNonPositiveParcelWeight) {
+    // arrange
+    CreateSwarm(4);
+
+    // act
+    // assert
+    ASSERT_THROW(TestInitializer::SetParcelWeight(swarm, 0.0), std::invalid_argument);
+    ASSERT_THROW(TestInitializer::SetParcelWeight(swarm, -1.0), std::invalid_argument);
+}
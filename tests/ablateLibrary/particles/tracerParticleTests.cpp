@@ -9,6 +9,7 @@
 #include "incompressibleFlow.h"
 #include "mathFunctions/functionFactory.hpp"
 #include "mesh/boxMesh.hpp"
+#include "parameters/mapParameters.hpp"
 #include "parameters/petscOptionParameters.hpp"
 #include "particles/tracer.hpp"
 
@@ -65,8 +66,74 @@ struct TracerParticleMMSParameters {
 class TracerParticleMMSTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<TracerParticleMMSParameters> {
    public:
     void SetUp() override { SetMpiParameters(GetParam().mpiTestParameter); }
+
+   protected:
+    /**
+     * creates the incompressible flow for the exact solution with the mms source terms
+     */
+    std::shared_ptr<ablate::flow::IncompressibleFlow> CreateFlow(TS ts, std::shared_ptr<ablate::mesh::BoxMesh> mesh) {
+        // Setup the flow data
+        const auto &testingParam = GetParam();
+
+        // pull the parameters from the petsc options
+        auto parameters = std::make_shared<ablate::parameters::PetscOptionParameters>();
+
+        auto velocityExact =
+            std::make_shared<mathFunctions::FieldFunction>("velocity", ablate::mathFunctions::Create(testingParam.uExact), ablate::mathFunctions::Create(testingParam.uDerivativeExact));
+        auto pressureExact =
+            std::make_shared<mathFunctions::FieldFunction>("pressure", ablate::mathFunctions::Create(testingParam.pExact), ablate::mathFunctions::Create(testingParam.pDerivativeExact));
+        auto temperatureExact =
+            std::make_shared<mathFunctions::FieldFunction>("temperature", ablate::mathFunctions::Create(testingParam.TExact), ablate::mathFunctions::Create(testingParam.TDerivativeExact));
+
+        auto flowObject = std::make_shared<ablate::flow::IncompressibleFlow>(
+            "testFlow",
+            mesh,
+            parameters,
+            nullptr,
+            /* initialization functions */
+            std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{velocityExact, pressureExact, temperatureExact},
+            /* boundary conditions */
+            std::vector<std::shared_ptr<boundaryConditions::BoundaryCondition>>{std::make_shared<boundaryConditions::Essential>("top wall velocity", 3, velocityExact),
+                                                                                std::make_shared<boundaryConditions::Essential>("bottom wall velocity", 1, velocityExact),
+                                                                                std::make_shared<boundaryConditions::Essential>("right wall velocity", 2, velocityExact),
+                                                                                std::make_shared<boundaryConditions::Essential>("left wall velocity", 4, velocityExact),
+                                                                                std::make_shared<boundaryConditions::Essential>("top wall temp", 3, temperatureExact),
+                                                                                std::make_shared<boundaryConditions::Essential>("bottom wall temp", 1, temperatureExact),
+                                                                                std::make_shared<boundaryConditions::Essential>("right wall temp", 2, temperatureExact),
+                                                                                std::make_shared<boundaryConditions::Essential>("left wall temp", 4, temperatureExact)},
+            /* aux updates*/
+            std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{},
+            /* exact solutions*/
+            std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{velocityExact, pressureExact, temperatureExact});
+
+        // Override problem with source terms, boundary, and set the exact solution
+        {
+            PetscDS prob;
+            DMGetDS(mesh->GetDomain(), &prob) >> testErrorChecker;
+
+            // V, W Test Function
+            IntegrandTestFunction tempFunctionPointer;
+            if (testingParam.f0_v) {
+                PetscDSGetResidual(prob, VTEST, &f0_v_original, &tempFunctionPointer) >> testErrorChecker;
+                PetscDSSetResidual(prob, VTEST, testingParam.f0_v, tempFunctionPointer) >> testErrorChecker;
+            }
+            if (testingParam.f0_w) {
+                PetscDSGetResidual(prob, WTEST, &f0_w_original, &tempFunctionPointer) >> testErrorChecker;
+                PetscDSSetResidual(prob, WTEST, testingParam.f0_w, tempFunctionPointer) >> testErrorChecker;
+            }
+            if (testingParam.f0_q) {
+                PetscDSGetResidual(prob, QTEST, &f0_q_original, &tempFunctionPointer) >> testErrorChecker;
+                PetscDSSetResidual(prob, QTEST, testingParam.f0_q, tempFunctionPointer) >> testErrorChecker;
+            }
+        }
+        flowObject->CompleteProblemSetup(ts);
+
+        return flowObject;
+    }
 };
 
+class TracerParticleFlowInterpolationTestFixture : public TracerParticleMMSTestFixture {};
+
 /*
   CASE: trigonometric-trigonometric
   In 2D we use exact solution:
@@ -220,6 +287,68 @@ static void SourceFunction(f0_linear_w) {
     f0[0] -= Cp * rho * (1 + S + X[0]);
 }
 
+/*
+  CASE: time dependent particle movement
+  In 2D we use exact solution:
+
+    x = t*t/2 + xo
+    y = t*t*t/6 + t*xo + yo
+    u = t
+    v = x
+    p = x + y - 1
+    T = t + x + y
+
+  so that
+
+    \nabla \cdot u = 0 + 0 = 0
+
+  f = S du/dt + u \cdot \nabla u - \nu \Delta u + \nabla p
+    = S <1, 0> + <0, t> - 0 + <1, 1>
+
+  Q = S dT/dt + u \cdot \nabla T - \alpha \Delta T
+    = S + t + x
+
+  The flow is linear in time, so the flow solution is exact at each step and any particle error beyond the particle ts comes from interpolating the flow in time.
+*/
+static PetscErrorCode timeDependent_x(PetscInt dim, PetscReal time, const PetscReal X[], PetscInt Nf, PetscScalar *x, void *ctx) {
+    const PetscReal x0 = X[0];
+    const PetscReal y0 = X[1];
+
+    x[0] = time * time / 2 + x0;
+    x[1] = time * time * time / 6 + time * x0 + y0;
+    return 0;
+}
+static PetscErrorCode timeDependent_u(PetscInt dim, PetscReal time, const PetscReal X[], PetscInt Nf, PetscScalar *u, void *ctx) {
+    u[0] = time;
+    u[1] = X[0];
+    return 0;
+}
+static PetscErrorCode timeDependent_u_t(PetscInt dim, PetscReal time, const PetscReal X[], PetscInt Nf, PetscScalar *u, void *ctx) {
+    u[0] = 1.0;
+    u[1] = 0.0;
+    return 0;
+}
+
+static void SourceFunction(f0_timeDependent_v) {
+    f0_v_original(dim, Nf, NfAux, uOff, uOff_x, u, u_t, u_x, aOff, aOff_x, a, a_t, a_x, t, X, numConstants, constants, f0);
+
+    const PetscReal rho = 1.0;
+    const PetscReal S = constants[STROUHAL];
+
+    f0[0] -= S * rho + 1;
+    f0[1] -= rho * t + 1;
+}
+
+static void SourceFunction(f0_timeDependent_w) {
+    f0_w_original(dim, Nf, NfAux, uOff, uOff_x, u, u_t, u_x, aOff, aOff_x, a, a_t, a_x, t, X, numConstants, constants, f0);
+
+    const PetscReal rho = 1.0;
+    const PetscReal S = constants[STROUHAL];
+    const PetscReal Cp = constants[CP];
+
+    f0[0] -= Cp * rho * (S + t + X[0]);
+}
+
 static PetscErrorCode MonitorFlowAndParticleError(TS ts, PetscInt step, PetscReal crtime, Vec u, void *ctx) {
     PetscErrorCode (*exactFuncs[3])(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar *u, void *ctx);
     void *ctxs[3];
@@ -298,59 +427,7 @@ TEST_P(TracerParticleMMSTestFixture, ParticleTracerFlowMMSTests) {
             TSSetDM(ts, mesh->GetDomain()) >> testErrorChecker;
             TSSetExactFinalTime(ts, TS_EXACTFINALTIME_MATCHSTEP) >> testErrorChecker;
 
-            // Setup the flow data
-            // pull the parameters from the petsc options
-            auto parameters = std::make_shared<ablate::parameters::PetscOptionParameters>();
-
-            auto velocityExact =
-                std::make_shared<mathFunctions::FieldFunction>("velocity", ablate::mathFunctions::Create(testingParam.uExact), ablate::mathFunctions::Create(testingParam.uDerivativeExact));
-            auto pressureExact =
-                std::make_shared<mathFunctions::FieldFunction>("pressure", ablate::mathFunctions::Create(testingParam.pExact), ablate::mathFunctions::Create(testingParam.pDerivativeExact));
-            auto temperatureExact =
-                std::make_shared<mathFunctions::FieldFunction>("temperature", ablate::mathFunctions::Create(testingParam.TExact), ablate::mathFunctions::Create(testingParam.TDerivativeExact));
-
-            auto flowObject = std::make_shared<ablate::flow::IncompressibleFlow>(
-                "testFlow",
-                mesh,
-                parameters,
-                nullptr,
-                /* initialization functions */
-                std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{velocityExact, pressureExact, temperatureExact},
-                /* boundary conditions */
-                std::vector<std::shared_ptr<boundaryConditions::BoundaryCondition>>{std::make_shared<boundaryConditions::Essential>("top wall velocity", 3, velocityExact),
-                                                                                    std::make_shared<boundaryConditions::Essential>("bottom wall velocity", 1, velocityExact),
-                                                                                    std::make_shared<boundaryConditions::Essential>("right wall velocity", 2, velocityExact),
-                                                                                    std::make_shared<boundaryConditions::Essential>("left wall velocity", 4, velocityExact),
-                                                                                    std::make_shared<boundaryConditions::Essential>("top wall temp", 3, temperatureExact),
-                                                                                    std::make_shared<boundaryConditions::Essential>("bottom wall temp", 1, temperatureExact),
-                                                                                    std::make_shared<boundaryConditions::Essential>("right wall temp", 2, temperatureExact),
-                                                                                    std::make_shared<boundaryConditions::Essential>("left wall temp", 4, temperatureExact)},
-                /* aux updates*/
-                std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{},
-                /* exact solutions*/
-                std::vector<std::shared_ptr<mathFunctions::FieldFunction>>{velocityExact, pressureExact, temperatureExact});
-
-            // Override problem with source terms, boundary, and set the exact solution
-            {
-                PetscDS prob;
-                DMGetDS(mesh->GetDomain(), &prob) >> testErrorChecker;
-
-                // V, W Test Function
-                IntegrandTestFunction tempFunctionPointer;
-                if (testingParam.f0_v) {
-                    PetscDSGetResidual(prob, VTEST, &f0_v_original, &tempFunctionPointer) >> testErrorChecker;
-                    PetscDSSetResidual(prob, VTEST, testingParam.f0_v, tempFunctionPointer) >> testErrorChecker;
-                }
-                if (testingParam.f0_w) {
-                    PetscDSGetResidual(prob, WTEST, &f0_w_original, &tempFunctionPointer) >> testErrorChecker;
-                    PetscDSSetResidual(prob, WTEST, testingParam.f0_w, tempFunctionPointer) >> testErrorChecker;
-                }
-                if (testingParam.f0_q) {
-                    PetscDSGetResidual(prob, QTEST, &f0_q_original, &tempFunctionPointer) >> testErrorChecker;
-                    PetscDSSetResidual(prob, QTEST, testingParam.f0_q, tempFunctionPointer) >> testErrorChecker;
-                }
-            }
-            flowObject->CompleteProblemSetup(ts);
+            auto flowObject = CreateFlow(ts, mesh);
 
             // Check the convergence
             DMTSCheckFromOptions(ts, flowObject->GetSolutionVector()) >> testErrorChecker;
@@ -384,6 +461,154 @@ TEST_P(TracerParticleMMSTestFixture, ParticleTracerFlowMMSTests) {
     EndWithMPI
 }
 
+/**
+ * the tracers for each flow interpolation order advanced with a coarse and fine particle ts
+ */
+struct FlowInterpolationMonitorContext {
+    std::vector<PetscInt> flowInterpolationOrders;
+    std::vector<std::pair<std::shared_ptr<ablate::particles::Tracer>, std::shared_ptr<ablate::particles::Tracer>>> particles;
+    ExactFunction particleExact;
+};
+
+// the max error in the particle location against the exact solution from each initial location
+static PetscReal ComputeMaxParticleError(ablate::particles::Tracer &particles, PetscReal time, ExactFunction particleExact) {
+    PetscErrorCode ierr;
+    PetscInt np;
+    ierr = DMSwarmGetLocalSize(particles.GetDM(), &np);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+
+    const PetscReal *coords, *initialLocations;
+    ierr = DMSwarmGetField(particles.GetDM(), DMSwarmPICField_coor, NULL, NULL, (void **)&coords);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+    ierr = DMSwarmGetField(particles.GetDM(), ablate::particles::Particles::ParticleInitialLocation, NULL, NULL, (void **)&initialLocations);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+    PetscReal maxError = 0.0;
+    for (PetscInt p = 0; p < np; p++) {
+        PetscScalar exact[2];
+        ierr = particleExact(2, time, initialLocations + p * 2, 2, exact, NULL);
+        CHKERRABORT(PETSC_COMM_WORLD, ierr);
+        for (PetscInt n = 0; n < 2; n++) {
+            maxError = PetscMax(maxError, PetscAbsReal(coords[p * 2 + n] - exact[n]));
+        }
+    }
+    ierr = DMSwarmRestoreField(particles.GetDM(), ablate::particles::Particles::ParticleInitialLocation, NULL, NULL, (void **)&initialLocations);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+    ierr = DMSwarmRestoreField(particles.GetDM(), DMSwarmPICField_coor, NULL, NULL, (void **)&coords);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+
+    PetscReal globalMaxError;
+    ierr = MPI_Allreduce(&maxError, &globalMaxError, 1, MPIU_REAL, MPIU_MAX, PETSC_COMM_WORLD);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+    return globalMaxError;
+}
+
+static PetscErrorCode MonitorFlowInterpolationConvergence(TS ts, PetscInt step, PetscReal crtime, Vec u, void *ctx) {
+    PetscErrorCode ierr;
+
+    PetscFunctionBeginUser;
+    // the particles start at the exact solution
+    if (step == 0) {
+        PetscFunctionReturn(0);
+    }
+
+    auto context = (FlowInterpolationMonitorContext *)ctx;
+    ierr = PetscPrintf(PETSC_COMM_WORLD, "Timestep: %04d time = %g\n", (int)step, (double)crtime);
+    CHKERRABORT(PETSC_COMM_WORLD, ierr);
+    for (std::size_t i = 0; i < context->particles.size(); i++) {
+        PetscReal coarseError = ComputeMaxParticleError(*context->particles[i].first, crtime, context->particleExact);
+        PetscReal fineError = ComputeMaxParticleError(*context->particles[i].second, crtime, context->particleExact);
+        ierr = PetscPrintf(PETSC_COMM_WORLD,
+                           "Flow Interpolation Order %D Particle Error: [%2.3g, %2.3g] Convergence Rate: %2.1f\n",
+                           context->flowInterpolationOrders[i],
+                           (double)coarseError,
+                           (double)fineError,
+                           (double)PetscLog2Real(coarseError / fineError));
+        CHKERRABORT(PETSC_COMM_WORLD, ierr);
+    }
+    PetscFunctionReturn(0);
+}
+
+TEST_P(TracerParticleFlowInterpolationTestFixture, ParticleShouldConvergeWithFlowInterpolation) {
+    StartWithMPI
+        {
+            TS ts; /* timestepper */
+
+            // Get the testing param
+            auto testingParam = GetParam();
+
+            // initialize petsc and mpi
+            PetscInitialize(argc, argv, NULL, NULL) >> testErrorChecker;
+
+            // setup the ts
+            TSCreate(PETSC_COMM_WORLD, &ts) >> testErrorChecker;
+            auto mesh = std::make_shared<ablate::mesh::BoxMesh>("mesh", std::vector<int>{2, 2}, std::vector<double>{0.0, 0.0}, std::vector<double>{1.0, 1.0});
+            TSSetDM(ts, mesh->GetDomain()) >> testErrorChecker;
+            TSSetExactFinalTime(ts, TS_EXACTFINALTIME_MATCHSTEP) >> testErrorChecker;
+
+            auto flowObject = CreateFlow(ts, mesh);
+
+            // Check the convergence
+            DMTSCheckFromOptions(ts, flowObject->GetSolutionVector()) >> testErrorChecker;
+
+            // advance the same particles with each flow interpolation order and two particle time steps.  The particles are not reset to the exact solution, so the error accumulates
+            // over the flow steps.
+            FlowInterpolationMonitorContext context{.flowInterpolationOrders = {0, 1, 2}, .particleExact = testingParam.particleExact};
+            auto initializer = std::make_shared<ablate::particles::initializers::BoxInitializer>(std::vector<double>{0.2, 0.2}, std::vector<double>{.5, .5}, 5);
+            for (const auto &order : context.flowInterpolationOrders) {
+                auto createParticles = [&](const std::string &name, const std::string &dt) {
+                    auto particleOptions = std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"ts_type", "euler"}, {"ts_dt", dt}});
+                    auto particles = std::make_shared<ablate::particles::Tracer>(
+                        name + std::to_string(order),
+                        2,
+                        initializer,
+                        ablate::mathFunctions::Create(testingParam.particleExact),
+                        particleOptions,
+                        std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"flowInterpolationOrder", std::to_string(order)}}));
+                    particles->InitializeFlow(flowObject);
+                    return particles;
+                };
+                context.particles.emplace_back(createParticles("coarseParticles", "0.05"), createParticles("fineParticles", "0.025"));
+            }
+
+            // setup the flow monitor to check the particles
+            TSMonitorSet(ts, MonitorFlowInterpolationConvergence, &context, NULL) >> testErrorChecker;
+            TSSetFromOptions(ts) >> testErrorChecker;
+
+            // Solve the one way coupled system
+            TSSolve(ts, flowObject->GetSolutionVector()) >> testErrorChecker;
+
+            // Compare the actual vs expected values
+            DMTSCheckFromOptions(ts, flowObject->GetSolutionVector()) >> testErrorChecker;
+
+            // Cleanup
+            TSDestroy(&ts) >> testErrorChecker;
+        }
+        exit(PetscFinalize());
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TracerParticleTests, TracerParticleFlowInterpolationTestFixture,
+    testing::Values((TracerParticleMMSParameters){.mpiTestParameter = {.testName = "particle flow interpolation in time dependent 2d flow tri_p2_p1_p1",
+                                                                       .nproc = 1,
+                                                                       .expectedOutputFile = "outputs/particles/tracerParticles_flow_interpolation_time_dependent_2d_tri_p2_p1_p1",
+                                                                       .arguments = "-dm_plex_separate_marker -dm_refine 2 -vel_petscspace_degree 2 -pres_petscspace_degree 1 "
+                                                                                    "-temp_petscspace_degree 1 -dmts_check .001 -ts_max_steps 4 -ts_dt 0.1 "
+                                                                                    "-ksp_type fgmres -ksp_gmres_restart 10 -ksp_rtol 1.0e-9 -ksp_error_if_not_converged "
+                                                                                    "-pc_type fieldsplit -pc_fieldsplit_0_fields 0,2 -pc_fieldsplit_1_fields 1 "
+                                                                                    "-pc_fieldsplit_type schur -pc_fieldsplit_schur_factorization_type full -fieldsplit_0_pc_type lu "
+                                                                                    "-fieldsplit_pressure_ksp_rtol 1e-10 -fieldsplit_pressure_pc_type jacobi"},
+                                                  .uExact = timeDependent_u,
+                                                  .pExact = linear_p,
+                                                  .TExact = linear_T,
+                                                  .uDerivativeExact = timeDependent_u_t,
+                                                  .pDerivativeExact = linear_p_t,
+                                                  .TDerivativeExact = linear_T_t,
+                                                  .particleExact = timeDependent_x,
+                                                  .f0_v = f0_timeDependent_v,
+                                                  .f0_w = f0_timeDependent_w}),
+    [](const testing::TestParamInfo<TracerParticleMMSParameters> &info) { return info.param.mpiTestParameter.getTestName(); });
+
 INSTANTIATE_TEST_SUITE_P(
     TracerParticleTests, TracerParticleMMSTestFixture,
     testing::Values((TracerParticleMMSParameters){.mpiTestParameter = {.testName = "particle in incompressible 2d trigonometric trigonometric tri_p2_p1_p1",
@@ -0,0 +1,92 @@
+#include <petsc.h>
+#include <lowStorageRK.h>
+#include <PetscTestFixture.hpp>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+struct LowStorageRKParameters {
+    std::string lsrkType;
+    PetscReal expectedOrder;
+};
+
+class LowStorageRKTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<LowStorageRKParameters> {};
+
+// u' = -u + sin(t) + cos(t) with the exact solution u = sin(t) + exp(-t), so the stage times are exercised along with the stage values
+static PetscReal Exact(PetscReal time) { return PetscSinReal(time) + PetscExpReal(-time); }
+
+static PetscErrorCode RHSFunction(TS ts, PetscReal t, Vec U, Vec F, void *ctx) {
+    PetscFunctionBeginUser;
+    const PetscScalar *u;
+    PetscScalar *f;
+    PetscErrorCode ierr;
+    ierr = VecGetArrayRead(U, &u);
+    CHKERRQ(ierr);
+    ierr = VecGetArray(F, &f);
+    CHKERRQ(ierr);
+    f[0] = -u[0] + PetscSinReal(t) + PetscCosReal(t);
+    ierr = VecRestoreArray(F, &f);
+    CHKERRQ(ierr);
+    ierr = VecRestoreArrayRead(U, &u);
+    CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+}
+
+TEST_P(LowStorageRKTestFixture, ShouldConvergeAtSchemeOrder) {
+    // arrange
+    const auto &params = GetParam();
+    TSRegisterLowStorageRK() >> errorChecker;
+
+    // select the scheme through the options as it would be from an input file
+    PetscOptions options;
+    PetscOptionsCreate(&options) >> errorChecker;
+    PetscOptionsSetValue(options, "-ts_type", TSLSRK) >> errorChecker;
+    PetscOptionsSetValue(options, "-ts_lsrk_type", params.lsrkType.c_str()) >> errorChecker;
+
+    const PetscReal endTime = 1.0;
+    const std::vector<PetscReal> timeSteps = {0.1, 0.05, 0.025};
+
+    // act
+    std::vector<PetscReal> errors;
+    for (const auto &dt : timeSteps) {
+        Vec u;
+        VecCreateSeq(PETSC_COMM_SELF, 1, &u) >> errorChecker;
+        VecSet(u, Exact(0.0)) >> errorChecker;
+
+        TS ts;
+        TSCreate(PETSC_COMM_SELF, &ts) >> errorChecker;
+        PetscObjectSetOptions((PetscObject)ts, options) >> errorChecker;
+        TSSetProblemType(ts, TS_NONLINEAR) >> errorChecker;
+        TSSetRHSFunction(ts, NULL, RHSFunction, NULL) >> errorChecker;
+        TSSetTime(ts, 0.0) >> errorChecker;
+        TSSetTimeStep(ts, dt) >> errorChecker;
+        TSSetMaxTime(ts, endTime) >> errorChecker;
+        TSSetExactFinalTime(ts, TS_EXACTFINALTIME_MATCHSTEP) >> errorChecker;
+        TSSetFromOptions(ts) >> errorChecker;
+
+        TSSolve(ts, u) >> errorChecker;
+
+        PetscReal time;
+        TSGetTime(ts, &time) >> errorChecker;
+        ASSERT_NEAR(endTime, time, 1E-12);
+
+        const PetscScalar *uArray;
+        VecGetArrayRead(u, &uArray) >> errorChecker;
+        errors.push_back(PetscAbsReal(uArray[0] - Exact(endTime)));
+        VecRestoreArrayRead(u, &uArray) >> errorChecker;
+
+        TSDestroy(&ts) >> errorChecker;
+        VecDestroy(&u) >> errorChecker;
+    }
+    PetscOptionsDestroy(&options) >> errorChecker;
+
+    // assert - halving the time step reduces the error by 2^order
+    for (std::size_t i = 1; i < errors.size(); i++) {
+        ASSERT_NEAR(params.expectedOrder, PetscLog2Real(errors[i - 1] / errors[i]), 0.15) << "for time step " << timeSteps[i];
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(LowStorageRKTests, LowStorageRKTestFixture,
+                         testing::Values((LowStorageRKParameters){.lsrkType = TSLSRK3, .expectedOrder = 3.0}, (LowStorageRKParameters){.lsrkType = TSLSRK4, .expectedOrder = 4.0}),
+                         [](const testing::TestParamInfo<LowStorageRKParameters> &info) { return "lsrk_" + info.param.lsrkType; });
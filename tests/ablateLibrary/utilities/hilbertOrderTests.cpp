@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include "gtest/gtest.h"
+#include "utilities/hilbertOrder.hpp"
+
+struct HilbertOrderTestParameters {
+    PetscInt dim;
+    PetscInt pointsPerDirection;
+};
+
+class HilbertOrderTestFixture : public ::testing::TestWithParam<HilbertOrderTestParameters> {};
+
+TEST_P(HilbertOrderTestFixture, ShouldVisitNeighboringGridPointsInOrder) {
+    // arrange
+    const auto& params = GetParam();
+    const PetscInt dim = params.dim;
+    const PetscInt n = params.pointsPerDirection;
+    const PetscReal lower[3] = {0.0, 0.0, 0.0};
+    const PetscReal upper[3] = {1.0, 1.0, 1.0};
+
+    // build the grid of cell centers
+    PetscInt numberPoints = 1;
+    for (PetscInt d = 0; d < dim; ++d) {
+        numberPoints *= n;
+    }
+    std::vector<std::vector<PetscInt>> indices(numberPoints, std::vector<PetscInt>(dim));
+    std::vector<uint64_t> keys(numberPoints);
+    for (PetscInt p = 0; p < numberPoints; ++p) {
+        PetscReal point[3];
+        PetscInt remainder = p;
+        for (PetscInt d = 0; d < dim; ++d) {
+            indices[p][d] = remainder % n;
+            remainder /= n;
+            point[d] = (indices[p][d] + 0.5) / n;
+        }
+
+        // act
+        keys[p] = ablate::utilities::HilbertOrder::ComputeKey(dim, point, lower, upper);
+    }
+
+    // assert
+    std::vector<PetscInt> order(numberPoints);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&keys](PetscInt a, PetscInt b) { return keys[a] < keys[b]; });
+    for (PetscInt i = 1; i < numberPoints; ++i) {
+        ASSERT_NE(keys[order[i - 1]], keys[order[i]]);
+        PetscInt distance = 0;
+        for (PetscInt d = 0; d < dim; ++d) {
+            distance += PetscAbsInt(indices[order[i]][d] - indices[order[i - 1]][d]);
+        }
+        ASSERT_EQ(distance, 1) << "points " << i - 1 << " and " << i << " along the curve should be neighbors";
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(HilbertOrderTests, HilbertOrderTestFixture,
+                         testing::Values((HilbertOrderTestParameters){.dim = 1, .pointsPerDirection = 16}, (HilbertOrderTestParameters){.dim = 2, .pointsPerDirection = 8},
+                                         (HilbertOrderTestParameters){.dim = 3, .pointsPerDirection = 4}),
+                         [](const testing::TestParamInfo<HilbertOrderTestParameters>& info) { return std::to_string(info.param.dim) + "D"; });
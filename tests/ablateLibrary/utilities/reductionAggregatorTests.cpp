@@ -0,0 +1,101 @@
+#include <PetscTestFixture.hpp>
+#include "MpiTestFixture.hpp"
+#include "PetscTestErrorChecker.hpp"
+#include "gtest/gtest.h"
+#include "utilities/reductionAggregator.hpp"
+
+class ReductionAggregatorTestFixture : public testingResources::PetscTestFixture {};
+
+TEST_F(ReductionAggregatorTestFixture, ShouldReduceMixedOperations) {
+    // arrange
+    ablate::utilities::ReductionAggregator aggregator(MPI_COMM_SELF);
+    auto minIndex = aggregator.Add(1.5, ablate::utilities::ReductionAggregator::Operation::MIN);
+    auto maxIndex = aggregator.Add(-2.0, ablate::utilities::ReductionAggregator::Operation::MAX);
+    auto sumIndex = aggregator.Add(3.0, ablate::utilities::ReductionAggregator::Operation::SUM);
+
+    // act
+    aggregator.Start();
+
+    // assert
+    ASSERT_DOUBLE_EQ(1.5, aggregator.Get(minIndex));
+    ASSERT_DOUBLE_EQ(-2.0, aggregator.Get(maxIndex));
+    ASSERT_DOUBLE_EQ(3.0, aggregator.Get(sumIndex));
+}
+
+TEST_F(ReductionAggregatorTestFixture, ShouldStartReductionWhenValueIsRequested) {
+    // arrange
+    ablate::utilities::ReductionAggregator aggregator(MPI_COMM_SELF);
+    auto index = aggregator.Add(4.0, ablate::utilities::ReductionAggregator::Operation::SUM);
+
+    // act
+    auto value = aggregator.Get(index);
+
+    // assert
+    ASSERT_DOUBLE_EQ(4.0, value);
+}
+
+TEST_F(ReductionAggregatorTestFixture, ShouldAllowReuseAfterReset) {
+    // arrange
+    ablate::utilities::ReductionAggregator aggregator(MPI_COMM_SELF);
+    aggregator.Add(4.0, ablate::utilities::ReductionAggregator::Operation::SUM);
+    aggregator.Start();
+    aggregator.Reset();
+
+    // act
+    auto index = aggregator.Add(2.0, ablate::utilities::ReductionAggregator::Operation::MAX);
+
+    // assert
+    ASSERT_EQ(0, index);
+    ASSERT_DOUBLE_EQ(2.0, aggregator.Get(index));
+}
+
+TEST_F(ReductionAggregatorTestFixture, ShouldNotAllowValuesAfterStart) {
+    // arrange
+    ablate::utilities::ReductionAggregator aggregator(MPI_COMM_SELF);
+    aggregator.Add(4.0, ablate::utilities::ReductionAggregator::Operation::SUM);
+    aggregator.Start();
+
+    // act
+    // assert
+    ASSERT_THROW(aggregator.Add(1.0, ablate::utilities::ReductionAggregator::Operation::SUM), std::runtime_error);
+}
+
+class ReductionAggregatorMpiTestFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<testingResources::MpiTestParameter> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam()); }
+};
+
+TEST_P(ReductionAggregatorMpiTestFixture, ShouldReduceMixedOperationsAcrossRanks) {
+    StartWithMPI
+        {
+            // arrange
+            PetscInitialize(argc, argv, NULL, NULL) >> testErrorChecker;
+            PetscMPIInt rank;
+            MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> testErrorChecker;
+            ablate::utilities::ReductionAggregator aggregator(PETSC_COMM_WORLD);
+
+            // reuse the aggregator to check that each reduction only holds its own values
+            for (PetscInt iteration = 0; iteration < 2; iteration++) {
+                auto minIndex = aggregator.Add(10.0 - rank + iteration, ablate::utilities::ReductionAggregator::Operation::MIN);
+                auto maxIndex = aggregator.Add(rank * rank + iteration, ablate::utilities::ReductionAggregator::Operation::MAX);
+                auto sumIndex = aggregator.Add(rank + 1.0, ablate::utilities::ReductionAggregator::Operation::SUM);
+
+                // act
+                aggregator.Start();
+                auto max = aggregator.Get(maxIndex);
+                auto min = aggregator.Get(minIndex);
+                auto sum = aggregator.Get(sumIndex);
+
+                // assert
+                PetscPrintf(PETSC_COMM_WORLD, "Min: %g Max: %g Sum: %g\n", (double)min, (double)max, (double)sum) >> testErrorChecker;
+                aggregator.Reset();
+            }
+        }
+        exit(PetscFinalize());
+    EndWithMPI
+}
+
+INSTANTIATE_TEST_SUITE_P(ReductionAggregatorTests, ReductionAggregatorMpiTestFixture,
+                         testing::Values((testingResources::MpiTestParameter){.testName = "reduction aggregator 2 proc", .nproc = 2, .expectedOutputFile = "outputs/utilities/reductionAggregator_2", .arguments = ""},
+                                         (testingResources::MpiTestParameter){.testName = "reduction aggregator 3 proc", .nproc = 3, .expectedOutputFile = "outputs/utilities/reductionAggregator_3", .arguments = ""}),
+                         [](const testing::TestParamInfo<testingResources::MpiTestParameter> &info) { return info.param.getTestName(); });
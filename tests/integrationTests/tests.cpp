@@ -70,8 +70,12 @@ TEST_P(IntegrationTestsSpecifier, ShouldRun) {
 INSTANTIATE_TEST_SUITE_P(
     Tests, IntegrationTestsSpecifier,
     testing::Values((MpiTestParameter){.testName = "inputs/compressibleCouetteFlow.yaml", .nproc = 1, .expectedOutputFile = "outputs/compressibleCouetteFlow.txt", .arguments = ""},
+                    (MpiTestParameter){.testName = "inputs/compressibleCouetteLocalTimeStepping.yaml", .nproc = 1, .expectedOutputFile = "outputs/compressibleCouetteLocalTimeStepping.txt", .arguments = ""},
+                    (MpiTestParameter){.testName = "inputs/compressibleSteadyStateRhs.yaml", .nproc = 1, .expectedOutputFile = "outputs/compressibleSteadyStateRhs.txt", .arguments = ""},
                     (MpiTestParameter){.testName = "inputs/incompressibleFlow.yaml", .nproc = 1, .expectedOutputFile = "outputs/incompressibleFlow.txt", .arguments = ""},
                     (MpiTestParameter){.testName = "inputs/tracerParticles2DHDF5Monitor.yaml", .nproc = 2, .expectedOutputFile = "outputs/tracerParticles2DHDF5Monitor.txt", .arguments = ""},
+                    (MpiTestParameter){.testName = "inputs/tracerParticles2DSubsample.yaml", .nproc = 2, .expectedOutputFile = "outputs/tracerParticles2DSubsample.txt", .arguments = ""},
+                    (MpiTestParameter){.testName = "inputs/tracerParticles2DRepartition.yaml", .nproc = 2, .expectedOutputFile = "outputs/tracerParticles2DRepartition.txt", .arguments = ""},
                     (MpiTestParameter){.testName = "inputs/tracerParticles3D.yaml", .nproc = 1, .expectedOutputFile = "outputs/tracerParticles3D.txt", .arguments = ""},
                     (MpiTestParameter){.testName = "inputs/compressibleFlowVortex.yaml", .nproc = 1, .expectedOutputFile = "outputs/compressibleFlowVortex.txt", .arguments = ""},
                     (MpiTestParameter){.testName = "inputs/customCouetteCompressibleFlow.yaml", .nproc = 1, .expectedOutputFile = "outputs/customCouetteCompressibleFlow.txt", .arguments = ""},
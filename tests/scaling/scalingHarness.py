@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""
+Strong/weak scaling harness for ablate.
+
+Takes any yaml input (e.g. from tests/integrationTests/inputs) and runs it with mpiexec over a range of ranks.  For weak
+scaling the BoxMesh faces are scaled so that the number of cells per rank is held constant, for strong scaling they are
+held fixed.  The timing for each run is collected from the PETSc log (-log_view) and the parallel efficiency of each
+stage/category is written to a csv file.
+
+Example:
+    python3 tests/scaling/scalingHarness.py --ablate build/ablate --input tests/integrationTests/inputs/compressibleFlowVortex.yaml \
+        --mode weak --ranks 1,2,4,8 --output vortexWeakScaling.csv
+"""
+import argparse
+import csv
+import math
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+# map each reported category to the log stages/events that hold its time.  The first match found in the log is used.
+CATEGORIES = {
+    'total': [('stage', 'timeStepper')],
+    'RHS': [('event', 'FVFlowRHS'), ('event', 'TSFunctionEval')],
+    'chemistry': [('stage', 'TChemReactions')],
+    'I/O': [('event', 'Hdf5Output')],
+    'particles': [('event', 'ParticleAdvect')],
+}
+
+FACES_REGEX = re.compile(r'^(\s*faces\s*:\s*)\[([^\]]*)\](.*)$')
+STAGE_REGEX = re.compile(r'^\s*\d+:\s+(.+?):\s+(\d+\.\d+e[+-]\d+)\s+')
+EVENT_REGEX = re.compile(r'^(\S+)\s+(\d+)\s+\S+\s+(\d+\.\d+e[+-]\d+)\s+')
+
+
+def scale_faces(input_text, scale):
+    """ Scales each BoxMesh faces entry in the yaml text so that the total number of cells is multiplied by scale """
+    output_lines = []
+    total_cells = None
+    for line in input_text.splitlines():
+        match = FACES_REGEX.match(line)
+        if match:
+            faces = [int(f) for f in match.group(2).split(',') if f.strip()]
+            dim_scale = scale ** (1.0 / len(faces))
+            faces = [max(1, int(round(f * dim_scale))) for f in faces]
+            total_cells = (total_cells or 0) + math.prod(faces)
+            line = match.group(1) + '[' + ', '.join(str(f) for f in faces) + ']' + match.group(3)
+        output_lines.append(line)
+    return '\n'.join(output_lines) + '\n', total_cells
+
+
+def parse_log(log_file, time_stepper_name):
+    """ Parses the -log_view output returning the time of each stage and the max time of each event summed over all stages """
+    stages = {}
+    events = {}
+    in_stage_summary = False
+    in_event_table = False
+    with open(log_file) as f:
+        for line in f:
+            if line.startswith('Summary of Stages'):
+                in_stage_summary = True
+                continue
+            if line.startswith('Event ') and 'Count' in line:
+                in_event_table = True
+                continue
+            if in_stage_summary:
+                match = STAGE_REGEX.match(line)
+                if match:
+                    stages[match.group(1).strip()] = float(match.group(2))
+                elif line.strip() == '' and stages:
+                    in_stage_summary = False
+            elif in_event_table:
+                match = EVENT_REGEX.match(line)
+                if match:
+                    events[match.group(1)] = events.get(match.group(1), 0.0) + float(match.group(3))
+
+    if time_stepper_name in stages:
+        stages['timeStepper'] = stages[time_stepper_name]
+    return stages, events
+
+
+def category_times(stages, events):
+    times = {}
+    for category, sources in CATEGORIES.items():
+        for source_type, name in sources:
+            values = stages if source_type == 'stage' else events
+            if name in values:
+                times[category] = values[name]
+                break
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Runs an ablate input over a range of mpi ranks and reports the parallel efficiency of each stage')
+    parser.add_argument('--ablate', required=True, help='path to the ablate executable')
+    parser.add_argument('--input', required=True, help='the yaml input file')
+    parser.add_argument('--mode', choices=['strong', 'weak'], default='strong', help='strong (fixed mesh) or weak (fixed cells per rank) scaling')
+    parser.add_argument('--ranks', default='1,2,4', help='comma separated list of mpi ranks to run')
+    parser.add_argument('--mpiexec', default='mpiexec', help='the mpiexec command')
+    parser.add_argument('--timeStepper', default='theMainTimeStepper', help='the name of the time stepper log stage')
+    parser.add_argument('--workDirectory', default='scalingRuns', help='where to write the inputs and outputs for each run')
+    parser.add_argument('--output', default='scaling.csv', help='the csv file to write the parallel efficiency')
+    parser.add_argument('arguments', nargs=argparse.REMAINDER, help='any additional arguments passed to ablate')
+    args = parser.parse_args()
+
+    ranks = [int(r) for r in args.ranks.split(',')]
+    with open(args.input) as f:
+        input_text = f.read()
+    input_directory = os.path.dirname(os.path.abspath(args.input))
+
+    results = []
+    for rank in ranks:
+        run_directory = os.path.abspath(os.path.join(args.workDirectory, '{}_{}'.format(args.mode, rank)))
+        os.makedirs(run_directory, exist_ok=True)
+
+        # copy over any supporting files (e.g. mechanism files) and write the scaled input
+        for file_name in os.listdir(input_directory):
+            source = os.path.join(input_directory, file_name)
+            if os.path.isfile(source) and not file_name.endswith('.yaml'):
+                shutil.copy(source, run_directory)
+        run_text, cells = scale_faces(input_text, rank if args.mode == 'weak' else 1)
+        run_input = os.path.join(run_directory, os.path.basename(args.input))
+        with open(run_input, 'w') as f:
+            f.write(run_text)
+
+        log_file = os.path.join(run_directory, 'log.txt')
+        command = [args.mpiexec, '-n', str(rank), os.path.abspath(args.ablate), '--input', run_input, '-log_view', ':' + log_file] + args.arguments
+        print(' '.join(command), flush=True)
+        subprocess.run(command, cwd=run_directory, check=True)
+
+        stages, events = parse_log(log_file, args.timeStepper)
+        results.append((rank, cells, category_times(stages, events)))
+
+    # compute the efficiency relative to the first run
+    base_rank, base_cells, base_times = results[0]
+    with open(args.output, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(['mode', 'ranks', 'cells', 'category', 'time', 'efficiency'])
+        for rank, cells, times in results:
+            for category in CATEGORIES:
+                if category not in times or category not in base_times:
+                    continue
+                time = times[category]
+                if time <= 0:
+                    efficiency = float('nan')
+                elif args.mode == 'strong':
+                    efficiency = (base_times[category] * base_rank) / (time * rank)
+                else:
+                    # normalize by the cells per rank in case the faces could not be scaled exactly
+                    base_cells_per_rank = (base_cells or 1) / base_rank
+                    cells_per_rank = (cells or 1) / rank
+                    efficiency = (base_times[category] / base_cells_per_rank) / (time / cells_per_rank)
+                writer.writerow([args.mode, rank, cells if cells is not None else '', category, time, efficiency])
+    print('wrote ' + args.output)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,33 @@
+#include "SwarmTestFixture.hpp"
+#include <petscdmplex.h>
+
+void testingResources::SwarmTestFixture::CreateCellDM(std::vector<PetscInt> faces, std::vector<PetscReal> lower, std::vector<PetscReal> upper) {
+    DMPlexCreateBoxMesh(PETSC_COMM_SELF, (PetscInt)faces.size(), PETSC_FALSE, faces.data(), lower.data(), upper.data(), NULL, PETSC_TRUE, &cellDM) >> errorChecker;
+}
+
+void testingResources::SwarmTestFixture::CreateSwarm(PetscInt np, const std::vector<std::pair<std::string, PetscInt>>& realFields, PetscInt dim) {
+    if (cellDM) {
+        DMGetDimension(cellDM, &dim) >> errorChecker;
+    }
+    DMCreate(PETSC_COMM_SELF, &swarm) >> errorChecker;
+    DMSetType(swarm, DMSWARM) >> errorChecker;
+    DMSetDimension(swarm, dim) >> errorChecker;
+    if (cellDM) {
+        DMSwarmSetType(swarm, DMSWARM_PIC) >> errorChecker;
+        DMSwarmSetCellDM(swarm, cellDM) >> errorChecker;
+    }
+    for (const auto& field : realFields) {
+        DMSwarmRegisterPetscDatatypeField(swarm, field.first.c_str(), field.second, PETSC_REAL) >> errorChecker;
+    }
+    DMSwarmFinalizeFieldRegister(swarm) >> errorChecker;
+    DMSwarmSetLocalSizes(swarm, np, 0) >> errorChecker;
+}
+
+void testingResources::SwarmTestFixture::TearDown() {
+    if (swarm) {
+        DMDestroy(&swarm) >> errorChecker;
+    }
+    if (cellDM) {
+        DMDestroy(&cellDM) >> errorChecker;
+    }
+}
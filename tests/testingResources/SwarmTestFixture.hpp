@@ -0,0 +1,51 @@
+#ifndef swarmtestfixture_h
+#define swarmtestfixture_h
+#include <petscdmswarm.h>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+#include "PetscTestFixture.hpp"
+
+namespace testingResources {
+
+/*Test fixture that builds a small serial swarm (and optional box cell dm) and destroys them after each test.*/
+class SwarmTestFixture : public PetscTestFixture {
+   protected:
+    DM swarm = nullptr;
+    DM cellDM = nullptr;
+
+    /**
+     * creates a serial box mesh that is used as the cell dm of the next swarm
+     * @param faces
+     * @param lower
+     * @param upper
+     */
+    void CreateCellDM(std::vector<PetscInt> faces, std::vector<PetscReal> lower, std::vector<PetscReal> upper);
+
+    /**
+     * creates a swarm with np local particles and the listed real fields (name, components).  The swarm is a PIC swarm on the cell dm if one was created.
+     * @param np
+     * @param realFields
+     * @param dim the swarm dimension when there is no cell dm
+     */
+    void CreateSwarm(PetscInt np, const std::vector<std::pair<std::string, PetscInt>>& realFields = {}, PetscInt dim = 2);
+
+    /**
+     * copies the values into the start of a swarm field
+     * @param fieldName
+     * @param values
+     */
+    template <typename T>
+    void SetField(const char* fieldName, const std::vector<T>& values) {
+        T* fieldData;
+        DMSwarmGetField(swarm, fieldName, NULL, NULL, (void**)&fieldData) >> errorChecker;
+        std::copy(values.begin(), values.end(), fieldData);
+        DMSwarmRestoreField(swarm, fieldName, NULL, NULL, (void**)&fieldData) >> errorChecker;
+    }
+
+    void TearDown() override;
+};
+
+};  // namespace testingResources
+#endif  // swarmtestfixture_h